@@ -0,0 +1,248 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+
+#include "Batch.hpp"
+#include "BinaryCnf.hpp"
+#include "Solver.hpp"
+#include "util/WorkQueue.hpp"
+
+namespace sat {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        bool isProblemFile(const std::filesystem::path &path) {
+            const std::string name = path.filename().string();
+            return std::ranges::any_of(std::initializer_list<std::string_view>{".cnf", ".cnf.gz", ".cnf.xz",
+                                                                              ".cnf.bz2", ".bcnf"},
+                                       [&name](std::string_view suffix) { return name.ends_with(suffix); });
+        }
+
+        std::string jsonString(std::string_view text) {
+            static constexpr char Hex[] = "0123456789abcdef";
+            std::string quoted = "\"";
+            for (char c : text) {
+                if (c == '"' || c == '\\') {
+                    quoted += '\\';
+                    quoted += c;
+                } else if (static_cast<unsigned char>(c) < 0x20) {
+                    quoted += "\\u00";
+                    quoted += Hex[(c >> 4) & 0xf];
+                    quoted += Hex[c & 0xf];
+                } else {
+                    quoted += c;
+                }
+            }
+
+            quoted += '"';
+            return quoted;
+        }
+
+        std::string csvField(std::string_view text) {
+            if (text.find_first_of(",\"\r\n") == std::string_view::npos) {
+                return std::string(text);
+            }
+
+            std::string quoted = "\"";
+            for (char c : text) {
+                if (c == '"') {
+                    quoted += '"';
+                }
+
+                quoted += c;
+            }
+
+            quoted += '"';
+            return quoted;
+        }
+
+        std::string fixed(double value) {
+            char buffer[32];
+            const auto res = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 3);
+            return std::string(buffer, res.ptr);
+        }
+
+        /**
+         * Instance currently processed by a worker, the watchdog interrupts it once its deadline has passed
+         */
+        struct Running {
+            std::mutex mutex;
+            std::optional<Clock::time_point> deadline;
+            std::stop_source stop;
+        };
+    }
+
+    std::vector<std::string> collect_instances(const std::string &path) {
+        namespace fs = std::filesystem;
+        std::vector<std::string> files;
+        if (fs::is_directory(path)) {
+            for (const auto &entry : fs::recursive_directory_iterator(path)) {
+                if (entry.is_regular_file() && isProblemFile(entry.path())) {
+                    files.push_back(entry.path().string());
+                }
+            }
+
+            std::ranges::sort(files);
+            return files;
+        }
+
+        std::ifstream list(path);
+        if (!list) {
+            throw std::runtime_error("Cannot open file " + path);
+        }
+
+        for (std::string line; std::getline(list, line);) {
+            while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) {
+                line.pop_back();
+            }
+
+            if (!line.empty() && line.front() != '#') {
+                files.push_back(std::move(line));
+            }
+        }
+
+        return files;
+    }
+
+    BatchResult solve_instance(const std::string &file, std::size_t memoryLimit, std::stop_token stop) {
+        const auto start = Clock::now();
+        BatchResult result;
+        result.file = file;
+        try {
+            SolverLoader loader;
+            inout::read_problem_file(file, loader);
+            Solver &solver = loader.solver();
+            result.variables = solver.numVariables();
+            const std::size_t limit = memoryLimit > 0 ? memoryLimit : std::numeric_limits<std::size_t>::max();
+            if (stop.stop_requested()) {
+                result.status = BatchStatus::Timeout;
+            } else if (solver.memoryUsage() > limit) {
+                result.status = BatchStatus::Memout;
+            } else if (!loader.ok()) {
+                result.status = BatchStatus::Unsat;
+            } else {
+                solver.setStopToken(std::move(stop));
+                solver.setMemoryLimit(limit);
+                const bool sat = solver.solve();
+                result.conflicts = solver.numConflicts();
+                if (!solver.interrupted()) {
+                    result.status = sat ? BatchStatus::Sat : BatchStatus::Unsat;
+                } else {
+                    result.status = solver.memoryUsage() > limit ? BatchStatus::Memout : BatchStatus::Timeout;
+                }
+            }
+        } catch (const std::exception &e) {
+            result.status = BatchStatus::Error;
+            result.error = e.what();
+        }
+
+        result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        return result;
+    }
+
+    void solve_batch(std::span<const std::string> files, const BatchOptions &options,
+                     const std::function<void(const BatchResult &)> &report) {
+        const std::size_t numThreads = std::clamp<std::size_t>(options.numThreads, 1,
+                                                               std::max<std::size_t>(files.size(), 1));
+        std::vector<WorkQueue<std::size_t>> queues(numThreads);
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            queues[i % numThreads].push(i);
+        }
+
+        std::vector<Running> running(numThreads);
+        std::mutex reportMutex;
+        const auto timeout = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(options.timeout));
+        std::jthread watchdog;
+        if (options.timeout > 0) {
+            watchdog = std::jthread([&running](std::stop_token stop) {
+                while (!stop.stop_requested()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    const auto now = Clock::now();
+                    for (auto &instance : running) {
+                        std::lock_guard lock(instance.mutex);
+                        if (instance.deadline && now >= *instance.deadline) {
+                            instance.stop.request_stop();
+                        }
+                    }
+                }
+            });
+        }
+
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(numThreads);
+            for (std::size_t i = 0; i < numThreads; ++i) {
+                workers.emplace_back([&, i] {
+                    // No new files are created, so the batch is done once all queues are empty
+                    while (true) {
+                        auto index = queues[i].pop();
+                        for (std::size_t k = 1; !index && k < numThreads; ++k) {
+                            index = queues[(i + k) % numThreads].steal();
+                        }
+
+                        if (!index) {
+                            return;
+                        }
+
+                        std::stop_token stop;
+                        {
+                            std::lock_guard lock(running[i].mutex);
+                            running[i].stop = std::stop_source();
+                            if (options.timeout > 0) {
+                                running[i].deadline = Clock::now() + timeout;
+                            }
+
+                            stop = running[i].stop.get_token();
+                        }
+
+                        const BatchResult result = solve_instance(files[*index], options.memoryLimit, stop);
+                        {
+                            std::lock_guard lock(running[i].mutex);
+                            running[i].deadline.reset();
+                        }
+
+                        std::lock_guard lock(reportMutex);
+                        report(result);
+                    }
+                });
+            }
+        }
+    }
+
+    std::string report_header(ReportFormat format) {
+        return format == ReportFormat::Csv ? "file,status,seconds,variables,conflicts,error\n" : "";
+    }
+
+    std::string format_result(const BatchResult &result, ReportFormat format) {
+        if (format == ReportFormat::Csv) {
+            return csvField(result.file) + ',' + to_string(result.status) + ',' + fixed(result.seconds) + ',' +
+                   std::to_string(result.variables) + ',' + std::to_string(result.conflicts) + ',' +
+                   csvField(result.error) + '\n';
+        }
+
+        std::string line = "{\"file\":" + jsonString(result.file) + ",\"status\":" +
+                           jsonString(to_string(result.status)) + ",\"seconds\":" + fixed(result.seconds) +
+                           ",\"variables\":" + std::to_string(result.variables) + ",\"conflicts\":" +
+                           std::to_string(result.conflicts);
+        if (!result.error.empty()) {
+            line += ",\"error\":" + jsonString(result.error);
+        }
+
+        line += "}\n";
+        return line;
+    }
+}
@@ -0,0 +1,107 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file Batch.hpp
+* @brief Contains the concurrent solving of many problem files with per-instance resource limits
+*/
+
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <string>
+#include <vector>
+#include <span>
+#include <functional>
+#include <stop_token>
+#include <cstddef>
+
+#include "util/enum.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Outcome of solving a single instance
+     * @details
+     * - Sat, Unsat: the instance has been solved
+     * - Timeout: the time limit was exceeded
+     * - Memout: the memory limit was exceeded
+     * - Error: the instance could not be read
+     */
+    PENUM(BatchStatus, Sat, Unsat, Timeout, Memout, Error)
+
+    /**
+     * @brief Output formats of batch results
+     * @details
+     * - Jsonl: one JSON object per line
+     * - Csv: comma separated values with a header line
+     */
+    PENUM(ReportFormat, Jsonl, Csv)
+
+    /**
+     * @brief Parameters of a batch run
+     */
+    struct BatchOptions {
+        std::size_t numThreads = 1; ///< number of worker threads
+        double timeout = 0; ///< wall clock limit per instance in seconds, 0 for no limit
+        std::size_t memoryLimit = 0; ///< memory limit per instance in bytes (see Solver::memoryUsage), 0 for no limit
+    };
+
+    /**
+     * @brief Result of a single instance
+     */
+    struct BatchResult {
+        std::string file; ///< path of the problem file
+        BatchStatus status = BatchStatus::Error; ///< outcome
+        double seconds = 0; ///< wall clock time including parsing
+        std::size_t variables = 0; ///< number of variables
+        std::size_t conflicts = 0; ///< number of conflicts
+        std::string error; ///< error message if status is BatchStatus::Error
+    };
+
+    /**
+     * Collects the problem files to solve
+     * @param path either a directory, which is searched recursively for files ending in .cnf, .cnf.gz, .cnf.xz,
+     * .cnf.bz2 or .bcnf, or a text file that lists one problem file per line (empty lines and lines starting with # are
+     * ignored)
+     * @return paths of the problem files, sorted if they come from a directory
+     * @throws std::runtime_error if the path cannot be read
+     */
+    std::vector<std::string> collect_instances(const std::string &path);
+
+    /**
+     * Solves a single problem file
+     * @param file path of the problem file
+     * @param memoryLimit memory limit in bytes, 0 for no limit
+     * @param stop token that interrupts the solver, a stopped instance counts as timed out
+     * @return the result
+     */
+    BatchResult solve_instance(const std::string &file, std::size_t memoryLimit, std::stop_token stop = {});
+
+    /**
+     * Solves problem files concurrently on a work-stealing thread pool. Each worker starts with an equal share of the
+     * files and takes files from the other workers once it runs out
+     * @param files paths of the problem files
+     * @param options thread count and limits
+     * @param report called once per file as soon as it is done. Calls are serialized, but come from the worker
+     * threads in completion order
+     */
+    void solve_batch(std::span<const std::string> files, const BatchOptions &options,
+                     const std::function<void(const BatchResult &)> &report);
+
+    /**
+     * Header line of a report
+     * @param format output format
+     * @return the header line including the line break, empty if the format has no header
+     */
+    std::string report_header(ReportFormat format);
+
+    /**
+     * Formats a result as one line of a report
+     * @param result the result
+     * @param format output format
+     * @return the line including the line break
+     */
+    std::string format_result(const BatchResult &result, ReportFormat format);
+}
+
+#endif //BATCH_HPP
@@ -0,0 +1,129 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+
+#include "BinaryCnf.hpp"
+
+namespace sat::inout {
+    namespace {
+        constexpr std::uint64_t FnvOffset = 14695981039346656037ull;
+        constexpr std::uint64_t FnvPrime = 1099511628211ull;
+
+        template<typename T>
+        std::uint64_t hashWords(std::uint64_t hash, std::span<const T> words) noexcept {
+            for (T w : words) {
+                hash = (hash ^ w) * FnvPrime;
+            }
+
+            return hash;
+        }
+
+        template<typename T>
+        void writeArray(std::ofstream &out, std::span<const T> data) {
+            out.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size_bytes()));
+        }
+    }
+
+    static_assert(sizeof(Literal) == sizeof(std::uint32_t), "literals are stored as 32 bit words");
+
+    std::uint64_t binary_cnf_checksum(std::span<const std::uint64_t> offsets,
+                                      std::span<const std::uint32_t> literals) noexcept {
+        return hashWords(hashWords(FnvOffset, offsets), literals);
+    }
+
+    bool is_binary_cnf(std::string_view data) noexcept {
+        return data.starts_with(std::string_view(BinaryCnfHeader::Magic, sizeof(BinaryCnfHeader::Magic)));
+    }
+
+    void write_binary_cnf(const std::string &path, const DimacsProblem &problem) {
+        std::vector<std::uint64_t> offsets;
+        offsets.reserve(problem.numClauses() + 1);
+        offsets.push_back(0);
+        offsets.insert(offsets.end(), problem.clauseEnds.begin(), problem.clauseEnds.end());
+        std::vector<std::uint32_t> literals;
+        literals.reserve(problem.literals.size());
+        std::ranges::transform(problem.literals, std::back_inserter(literals), [](Literal l) { return l.get(); });
+
+        BinaryCnfHeader header{};
+        std::ranges::copy(BinaryCnfHeader::Magic, header.magic);
+        header.version = BinaryCnfHeader::CurrentVersion;
+        header.byteOrder = BinaryCnfHeader::ByteOrderMark;
+        header.numVariables = problem.numVariables;
+        header.numClauses = problem.numClauses();
+        header.numLiterals = literals.size();
+        header.checksum = binary_cnf_checksum(offsets, literals);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            throw std::runtime_error("Cannot open file " + path + " for writing");
+        }
+
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        writeArray<std::uint64_t>(out, offsets);
+        writeArray<std::uint32_t>(out, literals);
+        if (!out) {
+            throw std::runtime_error("Cannot write file " + path);
+        }
+    }
+
+    BinaryProblem::BinaryProblem(const std::string &path) : mFile(path) {
+        const std::string_view data = mFile.view();
+        if (!is_binary_cnf(data) || data.size() < sizeof(BinaryCnfHeader)) {
+            throw std::runtime_error(path + " is not a binary CNF file");
+        }
+
+        mHeader = reinterpret_cast<const BinaryCnfHeader *>(data.data());
+        if (mHeader->version != BinaryCnfHeader::CurrentVersion || mHeader->byteOrder != BinaryCnfHeader::ByteOrderMark) {
+            throw std::runtime_error(path + " was written by an incompatible version or on a different architecture");
+        }
+
+        const std::size_t available = data.size() - sizeof(BinaryCnfHeader);
+        if (mHeader->numClauses >= available / sizeof(std::uint64_t)) {
+            throw std::runtime_error(path + " is truncated");
+        }
+
+        const std::size_t literalBytes = available - (mHeader->numClauses + 1) * sizeof(std::uint64_t);
+        if (literalBytes % sizeof(std::uint32_t) != 0 || literalBytes / sizeof(std::uint32_t) != mHeader->numLiterals) {
+            throw std::runtime_error(path + " is truncated");
+        }
+
+        const auto *offsets = reinterpret_cast<const std::uint64_t *>(data.data() + sizeof(BinaryCnfHeader));
+        mOffsets = std::span(offsets, mHeader->numClauses + 1);
+        const auto *literals = reinterpret_cast<const std::uint32_t *>(offsets + mOffsets.size());
+        const std::span<const std::uint32_t> literalWords(literals, mHeader->numLiterals);
+        if (binary_cnf_checksum(mOffsets, literalWords) != mHeader->checksum) {
+            throw std::runtime_error(path + " is corrupt (checksum mismatch)");
+        }
+
+        if (mOffsets.front() != 0 || mOffsets.back() != mHeader->numLiterals ||
+            !std::ranges::is_sorted(mOffsets) ||
+            std::ranges::any_of(literalWords, [this](std::uint32_t l) { return l / 2 >= mHeader->numVariables; })) {
+            throw std::runtime_error(path + " contains invalid clauses");
+        }
+
+        mLiterals = std::span(reinterpret_cast<const Literal *>(literals), mHeader->numLiterals);
+    }
+
+    std::size_t BinaryProblem::numVariables() const noexcept {
+        return mHeader->numVariables;
+    }
+
+    std::size_t BinaryProblem::numClauses() const noexcept {
+        return mHeader->numClauses;
+    }
+
+    std::size_t BinaryProblem::numLiterals() const noexcept {
+        return mHeader->numLiterals;
+    }
+
+    std::span<const Literal> BinaryProblem::clause(std::size_t index) const noexcept {
+        return mLiterals.subspan(mOffsets[index], mOffsets[index + 1] - mOffsets[index]);
+    }
+}
@@ -0,0 +1,169 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file BinaryCnf.hpp
+* @brief Contains a binary file format for pre-parsed problems that can be loaded without parsing
+*/
+
+#ifndef BINARYCNF_HPP
+#define BINARYCNF_HPP
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <ranges>
+
+#include "basic_structures.hpp"
+#include "inout.hpp"
+#include "util/MappedFile.hpp"
+
+namespace sat::inout {
+    /**
+     * @brief Header of a binary CNF file
+     * @details A binary CNF file consists of
+     * - this header
+     * - numClauses + 1 offsets (std::uint64_t): clause i consists of the literals [offsets[i], offsets[i + 1])
+     * - numLiterals literals (std::uint32_t, the values of Literal::get())
+     *
+     * All values are stored in the byte order of the machine that wrote the file. The checksum covers the offsets
+     * and the literals.
+     */
+    struct BinaryCnfHeader {
+        static constexpr char Magic[8] = {'S', 'A', 'T', 'B', 'C', 'N', 'F', '\0'};
+        static constexpr std::uint32_t CurrentVersion = 1;
+        static constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint64_t numVariables;
+        std::uint64_t numClauses;
+        std::uint64_t numLiterals;
+        std::uint64_t checksum;
+    };
+
+    static_assert(sizeof(BinaryCnfHeader) % sizeof(std::uint64_t) == 0, "offsets must be aligned");
+
+    /**
+     * Computes the checksum of the contents of a binary CNF file
+     * @param offsets clause offsets
+     * @param literals literal values
+     * @return 64-bit FNV-1a hash over all words
+     */
+    std::uint64_t binary_cnf_checksum(std::span<const std::uint64_t> offsets,
+                                      std::span<const std::uint32_t> literals) noexcept;
+
+    /**
+     * Checks whether the given data starts like a binary CNF file
+     * @param data file contents
+     */
+    bool is_binary_cnf(std::string_view data) noexcept;
+
+    /**
+     * Writes a problem in binary CNF format
+     * @param path output file
+     * @param problem problem to write
+     * @throws std::runtime_error if the file cannot be written
+     */
+    void write_binary_cnf(const std::string &path, const DimacsProblem &problem);
+
+    /**
+     * @brief Problem loaded from a binary CNF file.
+     * @details The file is memory mapped and the clauses are views on the mapped memory, so loading takes (almost) no
+     * time apart from validation.
+     */
+    class BinaryProblem {
+        MappedFile mFile;
+        const BinaryCnfHeader *mHeader = nullptr;
+        std::span<const std::uint64_t> mOffsets;
+        std::span<const Literal> mLiterals;
+    public:
+        /**
+         * Ctor. Maps and validates the given file
+         * @param path path to a binary CNF file
+         * @throws std::runtime_error if the file cannot be read, is not a binary CNF file of the current version,
+         * is truncated or corrupt
+         */
+        explicit BinaryProblem(const std::string &path);
+
+        /**
+         * Number of variables
+         */
+        std::size_t numVariables() const noexcept;
+
+        /**
+         * Number of clauses
+         */
+        std::size_t numClauses() const noexcept;
+
+        /**
+         * Total number of literals
+         */
+        std::size_t numLiterals() const noexcept;
+
+        /**
+         * Literals of a clause
+         * @param index index of the clause
+         * @return view on the literals of the clause
+         */
+        std::span<const Literal> clause(std::size_t index) const noexcept;
+
+        /**
+         * View on all clauses
+         */
+        auto clauses() const {
+            return std::views::iota(std::size_t(0), numClauses()) |
+                   std::views::transform([this](std::size_t i) { return clause(i); });
+        }
+    };
+
+    /**
+     * Streams a binary CNF file into a sink. If the sink has a member function clause(std::span<const Literal>), whole
+     * clauses are passed without copying, otherwise the literals are passed one by one
+     * @tparam S sink type
+     * @param path path to a binary CNF file
+     * @param sink receives the header and the clauses
+     * @throws std::runtime_error if the file cannot be read or is invalid
+     */
+    template<dimacs_sink S>
+    void read_binary_cnf(const std::string &path, S &sink) {
+        const BinaryProblem problem(path);
+        sink.header(problem.numVariables(), problem.numClauses());
+        for (auto clause : problem.clauses()) {
+            if constexpr (requires { sink.clause(clause); }) {
+                sink.clause(clause);
+            } else {
+                for (Literal l : clause) {
+                    sink.literal(l);
+                }
+
+                sink.endClause();
+            }
+        }
+    }
+
+    /**
+     * Reads a problem file into a sink. Binary CNF files and (possibly compressed) dimacs files are supported
+     * @tparam S sink type
+     * @param path path to the problem file
+     * @param sink receives the header and the clauses
+     * @throws std::runtime_error if the file cannot be read or is invalid
+     */
+    template<dimacs_sink S>
+    void read_problem_file(const std::string &path, S &sink) {
+        bool binary;
+        {
+            const MappedFile file(path);
+            binary = is_binary_cnf(file.view());
+        }
+
+        if (binary) {
+            read_binary_cnf(path, sink);
+        } else {
+            read_dimacs_file(path, sink);
+        }
+    }
+}
+
+#endif //BINARYCNF_HPP
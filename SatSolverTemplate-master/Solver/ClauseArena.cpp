@@ -0,0 +1,50 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+
+#include "ClauseArena.hpp"
+
+namespace sat {
+
+    void ClauseArena::free(ClauseRef ref) {
+        ArenaClause &clause = operator[](ref);
+        if (!clause.mDeleted) {
+            clause.mDeleted = true;
+            mWasted += HeaderWords + clause.size();
+        }
+    }
+
+    ClauseRef ClauseArena::relocate(ClauseRef ref, ClauseArena &to) {
+        ArenaClause &clause = operator[](ref);
+        if (clause.mRelocated) {
+            return clause.mSearchPos;
+        }
+
+        const ClauseRef newRef = to.alloc(clause, clause.mLearnt);
+        ArenaClause &copy = to[newRef];
+        copy.mSearchPos = clause.mSearchPos;
+        copy.mUsed = clause.mUsed;
+        copy.mImported = clause.mImported;
+        copy.mTier = clause.mTier;
+        copy.mLbd = clause.mLbd;
+        copy.mActivity = clause.mActivity;
+        copy.setId(clause.id());
+        clause.mRelocated = true;
+        clause.mSearchPos = newRef;
+        return newRef;
+    }
+
+    void ClauseArena::reserve(std::size_t numWords) {
+        mMemory.reserve(numWords);
+    }
+
+    std::size_t ClauseArena::size() const {
+        return mMemory.size();
+    }
+
+    std::size_t ClauseArena::wasted() const {
+        return mWasted;
+    }
+}
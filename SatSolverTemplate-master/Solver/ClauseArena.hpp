@@ -0,0 +1,334 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @file ClauseArena.hpp
+* @brief Contains a contiguous clause storage where clauses are addressed by 32-bit references
+*/
+
+#ifndef CLAUSEARENA_HPP
+#define CLAUSEARENA_HPP
+
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <vector>
+
+#include "basic_structures.hpp"
+#include "Clause.hpp"
+
+namespace sat {
+
+    /**
+     * Reference to a clause inside a ClauseArena. This is the offset of the clause header in the arena memory.
+     */
+    using ClauseRef = std::uint32_t;
+
+    /**
+     * Reference that does not point to any clause (used e.g. as reason of decisions)
+     */
+    inline constexpr ClauseRef NoClause = std::numeric_limits<ClauseRef>::max();
+
+    /**
+     * @brief Tiers of learned clauses
+     * @details
+     * - Core: clauses with very small LBD, they are never deleted
+     * - Tier2: clauses with small LBD, kept as long as they are used in conflict analysis from time to time
+     * - Local: all other learned clauses, the less active half is periodically deleted
+     */
+    enum class ClauseTier : std::uint32_t {
+        Core = 0,
+        Tier2 = 1,
+        Local = 2
+    };
+
+    /**
+     * @brief Clause as it is stored inside a ClauseArena.
+     * @details The header is immediately followed by the literals of the clause, so a clause occupies one contiguous
+     * block of memory. The first two literals are the watchers of the clause. Instances of this class are never
+     * constructed directly, they only exist as views on arena memory.
+     */
+    class ArenaClause {
+        friend class ClauseArena;
+        std::uint32_t mSize;
+        // position at which the search for a replacement watcher resumes
+        std::uint32_t mSearchPos;
+        std::uint32_t mLearnt : 1;
+        std::uint32_t mDeleted : 1;
+        // if set, the clause has been moved to another arena and mSearchPos holds its new reference
+        std::uint32_t mRelocated : 1;
+        std::uint32_t mUsed : 1;
+        // if set, the clause was received from another solver and has not been used in conflict analysis yet
+        std::uint32_t mImported : 1;
+        std::uint32_t mTier : 2;
+        std::uint32_t mLbd : 25;
+        float mActivity;
+        // the 64-bit id is split into two words as arena memory is only aligned to 32 bits
+        std::uint32_t mIdLow;
+        std::uint32_t mIdHigh;
+
+        ArenaClause() = default;
+
+    public:
+        ArenaClause(const ArenaClause &) = delete;
+        ArenaClause &operator=(const ArenaClause &) = delete;
+
+        /**
+         * Number of literals in this clause
+         */
+        std::size_t size() const {
+            return mSize;
+        }
+
+        /**
+         * Subscript operator for random access
+         * @param index Which literal to retrieve
+         * @return reference to the literal at position index
+         */
+        Literal &operator[](std::size_t index) {
+            return begin()[index];
+        }
+
+        /**
+         * @copydoc operator[](std::size_t)
+         */
+        Literal operator[](std::size_t index) const {
+            return begin()[index];
+        }
+
+        /**
+         * Returns a pointer to the first literal of this clause
+         */
+        Literal *begin() {
+            return reinterpret_cast<Literal *>(this + 1);
+        }
+
+        /**
+         * @copydoc begin()
+         */
+        const Literal *begin() const {
+            return reinterpret_cast<const Literal *>(this + 1);
+        }
+
+        /**
+         * Returns a pointer to one-past-the-last literal of this clause
+         */
+        Literal *end() {
+            return begin() + mSize;
+        }
+
+        /**
+         * @copydoc end()
+         */
+        const Literal *end() const {
+            return begin() + mSize;
+        }
+
+        /**
+         * Position at which the next search for a replacement watcher should start
+         */
+        std::uint32_t searchPos() const {
+            return mSearchPos;
+        }
+
+        /**
+         * Sets the position at which the next search for a replacement watcher should start
+         */
+        void setSearchPos(std::uint32_t pos) {
+            mSearchPos = pos;
+        }
+
+        /**
+         * Whether this clause was derived during conflict analysis
+         */
+        bool learnt() const {
+            return mLearnt;
+        }
+
+        /**
+         * Whether this clause has been freed
+         */
+        bool deleted() const {
+            return mDeleted;
+        }
+
+        /**
+         * Literal block distance (number of distinct decision levels) the clause had when it was last computed
+         */
+        unsigned lbd() const {
+            return mLbd;
+        }
+
+        /**
+         * Updates the literal block distance
+         */
+        void setLbd(unsigned lbd) {
+            mLbd = std::min<unsigned>(lbd, (1u << 25) - 1);
+        }
+
+        /**
+         * Tier of a learned clause
+         */
+        ClauseTier tier() const {
+            return static_cast<ClauseTier>(mTier);
+        }
+
+        /**
+         * Moves a learned clause to another tier
+         */
+        void setTier(ClauseTier tier) {
+            mTier = static_cast<std::uint32_t>(tier);
+        }
+
+        /**
+         * Whether the clause took part in conflict analysis since the flag was last reset
+         */
+        bool used() const {
+            return mUsed;
+        }
+
+        /**
+         * Sets or resets the used flag
+         */
+        void setUsed(bool used) {
+            mUsed = used;
+        }
+
+        /**
+         * Whether the clause was received from another solver (see ExchangePort) and has not been used in conflict
+         * analysis since
+         */
+        bool imported() const {
+            return mImported;
+        }
+
+        /**
+         * Sets or resets the imported flag
+         */
+        void setImported(bool imported) {
+            mImported = imported;
+        }
+
+        /**
+         * Activity of a learned clause (how often it took part in recent conflicts)
+         */
+        float activity() const {
+            return mActivity;
+        }
+
+        /**
+         * Sets the activity of a learned clause
+         */
+        void setActivity(float activity) {
+            mActivity = activity;
+        }
+
+        /**
+         * Unique id of the clause used in proofs (see Proof)
+         */
+        std::uint64_t id() const {
+            return static_cast<std::uint64_t>(mIdHigh) << 32 | mIdLow;
+        }
+
+        /**
+         * Sets the id of the clause
+         */
+        void setId(std::uint64_t id) {
+            mIdLow = static_cast<std::uint32_t>(id);
+            mIdHigh = static_cast<std::uint32_t>(id >> 32);
+        }
+    };
+
+    static_assert(sizeof(Literal) == sizeof(std::uint32_t), "Literals must fit into one arena word");
+    static_assert(sizeof(ArenaClause) % sizeof(std::uint32_t) == 0, "Clause header must consist of whole words");
+
+    /**
+     * @brief Contiguous storage of clauses.
+     * @details All clauses live in a single buffer of 32-bit words. A clause is addressed by a ClauseRef which stays
+     * valid when the buffer grows. Pointers and references to ArenaClause objects on the other hand are invalidated
+     * by alloc().
+     */
+    class ClauseArena {
+        std::vector<std::uint32_t> mMemory;
+        std::size_t mWasted = 0;
+
+    public:
+        static constexpr std::size_t HeaderWords = sizeof(ArenaClause) / sizeof(std::uint32_t);
+
+        /**
+         * Stores a new clause in the arena
+         * @tparam C clause type
+         * @param literals literals of the clause. The first two literals become the watchers
+         * @param learnt whether the clause was learned
+         * @return reference to the new clause
+         */
+        template<clause_like C>
+        ClauseRef alloc(const C &literals, bool learnt) {
+            const auto ref = static_cast<ClauseRef>(mMemory.size());
+            mMemory.resize(mMemory.size() + HeaderWords);
+            for (Literal l : literals) {
+                mMemory.push_back(l.get());
+            }
+
+            ArenaClause &clause = operator[](ref);
+            clause.mSize = static_cast<std::uint32_t>(mMemory.size() - ref - HeaderWords);
+            clause.mSearchPos = 2;
+            clause.mLearnt = learnt;
+            clause.mDeleted = false;
+            clause.mRelocated = false;
+            clause.mUsed = false;
+            clause.mImported = false;
+            clause.mTier = static_cast<std::uint32_t>(learnt ? ClauseTier::Local : ClauseTier::Core);
+            clause.mLbd = 0;
+            clause.mActivity = 0;
+            clause.setId(0);
+            return ref;
+        }
+
+        /**
+         * Copies a clause into another arena. Subsequent calls with the same reference return the same new reference.
+         * @param ref reference to a clause in this arena that has not been freed
+         * @param to destination arena
+         * @return reference of the copy in the destination arena
+         */
+        ClauseRef relocate(ClauseRef ref, ClauseArena &to);
+
+        /**
+         * Marks the given clause as deleted. Its memory is not reclaimed.
+         * @param ref reference to the clause
+         */
+        void free(ClauseRef ref);
+
+        /**
+         * Access to a stored clause
+         * @param ref reference to the clause
+         * @return the clause
+         */
+        ArenaClause &operator[](ClauseRef ref) {
+            return *reinterpret_cast<ArenaClause *>(mMemory.data() + ref);
+        }
+
+        /**
+         * @copydoc operator[](ClauseRef)
+         */
+        const ArenaClause &operator[](ClauseRef ref) const {
+            return *reinterpret_cast<const ArenaClause *>(mMemory.data() + ref);
+        }
+
+        /**
+         * Reserves space for the given number of words
+         */
+        void reserve(std::size_t numWords);
+
+        /**
+         * Number of words in use (including freed clauses)
+         */
+        std::size_t size() const;
+
+        /**
+         * Number of words occupied by freed clauses
+         */
+        std::size_t wasted() const;
+    };
+}
+
+#endif //CLAUSEARENA_HPP
@@ -0,0 +1,134 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <thread>
+
+#include "ClauseExchange.hpp"
+
+namespace sat {
+
+    ClauseExchange::ClauseExchange(std::size_t capacity) :
+        mSlots(std::make_unique<Slot[]>(std::max<std::size_t>(capacity, 1))),
+        mCapacity(std::max<std::size_t>(capacity, 1)) {}
+
+    bool ClauseExchange::publish(unsigned source, std::span<const Literal> clause, unsigned lbd) {
+        if (clause.size() > MaxLiterals) {
+            return false;
+        }
+
+        const std::uint64_t position = mHead.fetch_add(1, std::memory_order_relaxed);
+        Slot &slot = mSlots[position % mCapacity];
+        const std::uint64_t writing = 2 * position + 1;
+        auto sequence = slot.sequence.load(std::memory_order_relaxed);
+        while (true) {
+            if (sequence >= writing) {
+                // A publisher one lap ahead already owns the slot, readers will consider this position lost
+                return false;
+            }
+
+            if (sequence & 1) {
+                // The publisher one lap behind is still writing, which only happens if it was stalled for a full lap
+                std::this_thread::yield();
+                sequence = slot.sequence.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (slot.sequence.compare_exchange_weak(sequence, writing, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.source.store(source, std::memory_order_relaxed);
+        slot.lbd.store(lbd, std::memory_order_relaxed);
+        slot.size.store(static_cast<std::uint32_t>(clause.size()), std::memory_order_relaxed);
+        for (std::size_t i = 0; i < clause.size(); ++i) {
+            slot.literals[i].store(clause[i].get(), std::memory_order_relaxed);
+        }
+
+        slot.sequence.store(writing + 1, std::memory_order_release);
+        return true;
+    }
+
+    auto ClauseExchange::read(std::uint64_t position, SharedClause &clause) const -> ReadResult {
+        const Slot &slot = mSlots[position % mCapacity];
+        const std::uint64_t complete = 2 * position + 2;
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence < complete) {
+            return ReadResult::Pending;
+        }
+
+        if (sequence > complete) {
+            return ReadResult::Lost;
+        }
+
+        clause.source = slot.source.load(std::memory_order_relaxed);
+        clause.lbd = slot.lbd.load(std::memory_order_relaxed);
+        const auto size = std::min<std::size_t>(slot.size.load(std::memory_order_relaxed), MaxLiterals);
+        clause.literals.clear();
+        for (std::size_t i = 0; i < size; ++i) {
+            clause.literals.emplace_back(slot.literals[i].load(std::memory_order_relaxed));
+        }
+
+        // If the slot has been claimed again in the meantime, the copy may be torn
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != complete) {
+            return ReadResult::Lost;
+        }
+
+        return ReadResult::Ok;
+    }
+
+    std::uint64_t ClauseExchange::oldest() const {
+        const auto head = mHead.load(std::memory_order_relaxed);
+        return head > mCapacity ? head - mCapacity : 0;
+    }
+
+    std::size_t ClauseExchange::capacity() const {
+        return mCapacity;
+    }
+
+    ExchangePort::ExchangePort(ClauseExchange &exchange, unsigned id, unsigned maxSize, unsigned maxLbd) :
+        mExchange(&exchange), mId(id), mMaxSize(maxSize), mMaxLbd(maxLbd) {}
+
+    bool ExchangePort::remember(std::span<const Literal> clause) {
+        mSorted.assign(clause.begin(), clause.end());
+        std::ranges::sort(mSorted, {}, [](Literal l) { return l.get(); });
+        // FNV-1a over the literal ids
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (Literal l : mSorted) {
+            hash = (hash ^ l.get()) * 0x100000001b3ull;
+        }
+
+        if (mKnown.size() >= MaxKnown) {
+            mKnown.clear();
+        }
+
+        return mKnown.insert(hash).second;
+    }
+
+    bool ExchangePort::offer(std::span<const Literal> clause, unsigned lbd) {
+        if (clause.size() > ClauseExchange::MaxLiterals || (clause.size() > mMaxSize && lbd > mMaxLbd)) {
+            return false;
+        }
+
+        if (!remember(clause) || !mExchange->publish(mId, clause, lbd)) {
+            return false;
+        }
+
+        ++mStats.exported;
+        return true;
+    }
+
+    void ExchangePort::importedClauseUsed() {
+        ++mStats.used;
+    }
+
+    const ExchangeStats &ExchangePort::stats() const {
+        return mStats;
+    }
+}
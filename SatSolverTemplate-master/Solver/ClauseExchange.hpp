@@ -0,0 +1,198 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file ClauseExchange.hpp
+* @brief Contains the exchange of learned clauses between solvers running in parallel
+*/
+
+#ifndef CLAUSEEXCHANGE_HPP
+#define CLAUSEEXCHANGE_HPP
+
+#include <atomic>
+#include <array>
+#include <memory>
+#include <vector>
+#include <span>
+#include <unordered_set>
+#include <concepts>
+#include <cstdint>
+#include <cstddef>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * @brief A clause read from a ClauseExchange
+     */
+    struct SharedClause {
+        unsigned source = 0; ///< id of the exporting solver
+        unsigned lbd = 0; ///< LBD of the clause in the exporting solver
+        std::vector<Literal> literals; ///< literals of the clause
+    };
+
+    /**
+     * @brief Lock-free ring buffer through which solvers broadcast learned clauses to each other.
+     * @details Any number of threads may publish clauses concurrently, each publisher claims a position by an atomic
+     * increment. Every reader keeps its own position and reads all clauses in publishing order. The ring never
+     * blocks: slow readers miss the clauses that have been overwritten in the meantime. Each slot is protected by a
+     * sequence number (seqlock), so readers detect concurrent overwrites and skip the affected clause.
+     */
+    class ClauseExchange {
+    public:
+        static constexpr std::size_t MaxLiterals = 28; ///< size limit of exchanged clauses (slots have fixed size)
+        static constexpr std::size_t DefaultCapacity = 1 << 14;
+
+        /**
+         * @brief Outcome of reading a position
+         * @details
+         * - Ok: the clause has been read
+         * - Pending: no clause has been published at the position yet
+         * - Lost: the clause has already been overwritten
+         */
+        enum class ReadResult { Ok, Pending, Lost };
+
+    private:
+        struct Slot {
+            // 2 * position + 1 while the clause at position is written, 2 * position + 2 once it is complete
+            std::atomic<std::uint64_t> sequence = 0;
+            std::atomic<std::uint32_t> source = 0;
+            std::atomic<std::uint32_t> lbd = 0;
+            std::atomic<std::uint32_t> size = 0;
+            std::array<std::atomic<std::uint32_t>, MaxLiterals> literals{};
+        };
+
+        std::unique_ptr<Slot[]> mSlots;
+        std::size_t mCapacity;
+        std::atomic<std::uint64_t> mHead = 0; // number of claimed positions
+
+    public:
+        /**
+         * Ctor
+         * @param capacity number of clauses the ring can hold
+         */
+        explicit ClauseExchange(std::size_t capacity = DefaultCapacity);
+
+        /**
+         * Publishes a clause
+         * @param source id of the publishing solver
+         * @param clause the clause, at most MaxLiterals literals
+         * @param lbd LBD of the clause
+         * @return false if the clause is too large or its slot was still being written by a much older publication,
+         * true otherwise
+         */
+        bool publish(unsigned source, std::span<const Literal> clause, unsigned lbd);
+
+        /**
+         * Reads the clause at the given position
+         * @param position position of the clause, starting at 0
+         * @param clause output: the clause
+         * @return whether the clause could be read. The output is only valid if ReadResult::Ok is returned
+         */
+        ReadResult read(std::uint64_t position, SharedClause &clause) const;
+
+        /**
+         * Oldest position that has not been overwritten yet
+         */
+        std::uint64_t oldest() const;
+
+        /**
+         * Number of clauses the ring can hold
+         */
+        std::size_t capacity() const;
+    };
+
+    /**
+     * @brief Counters of the clause exchange of a single solver
+     */
+    struct ExchangeStats {
+        std::size_t exported = 0; ///< number of learned clauses published
+        std::size_t imported = 0; ///< number of clauses received from other solvers
+        std::size_t used = 0; ///< number of imported clauses that took part in conflict analysis
+    };
+
+    /**
+     * @brief Connection of one solver to a ClauseExchange (see Solver::setExchange).
+     * @details Filters the exported clauses by size and LBD and drops clauses that have already been exported or
+     * imported before. Duplicates are recognized by a hash of the sorted literals. A port is used by a single thread.
+     */
+    class ExchangePort {
+        ClauseExchange *mExchange;
+        unsigned mId;
+        unsigned mMaxSize;
+        unsigned mMaxLbd;
+        std::uint64_t mPosition = 0;
+        std::unordered_set<std::uint64_t> mKnown;
+        std::vector<Literal> mSorted;
+        SharedClause mReceived;
+        ExchangeStats mStats;
+
+        /**
+         * Remembers a clause
+         * @return true if the clause has not been seen before
+         */
+        bool remember(std::span<const Literal> clause);
+
+    public:
+        static constexpr unsigned DefaultMaxSize = 8;
+        static constexpr unsigned DefaultMaxLbd = 3;
+        static constexpr std::size_t MaxKnown = 1 << 20; ///< number of remembered clauses before forgetting all
+
+        /**
+         * Ctor
+         * @param exchange the shared clause exchange
+         * @param id id of the solver, must be unique among all ports of the exchange
+         * @param maxSize clauses up to this size are exported regardless of their LBD
+         * @param maxLbd clauses up to this LBD are exported regardless of their size (up to
+         * ClauseExchange::MaxLiterals)
+         */
+        ExchangePort(ClauseExchange &exchange, unsigned id, unsigned maxSize = DefaultMaxSize,
+                     unsigned maxLbd = DefaultMaxLbd);
+
+        /**
+         * Exports a learned clause if it is short or has a small LBD and has not been exchanged before
+         * @param clause the learned clause
+         * @param lbd its LBD
+         * @return true if the clause has been published
+         */
+        bool offer(std::span<const Literal> clause, unsigned lbd);
+
+        /**
+         * Receives all clauses published by other solvers since the last call, except duplicates
+         * @tparam F callable with signature void(std::span<const Literal>, unsigned)
+         * @param consumer called with the literals and the LBD of each new clause
+         */
+        template<std::invocable<std::span<const Literal>, unsigned> F>
+        void receive(F &&consumer) {
+            while (true) {
+                const auto result = mExchange->read(mPosition, mReceived);
+                if (result == ClauseExchange::ReadResult::Pending) {
+                    return;
+                }
+
+                if (result == ClauseExchange::ReadResult::Lost) {
+                    mPosition = std::max(mPosition + 1, mExchange->oldest());
+                    continue;
+                }
+
+                ++mPosition;
+                if (mReceived.source != mId && remember(mReceived.literals)) {
+                    ++mStats.imported;
+                    consumer(std::span<const Literal>(mReceived.literals), mReceived.lbd);
+                }
+            }
+        }
+
+        /**
+         * Notifies the port that an imported clause took part in conflict analysis for the first time
+         */
+        void importedClauseUsed();
+
+        /**
+         * Exchange counters of this solver
+         */
+        const ExchangeStats &stats() const;
+    };
+}
+
+#endif //CLAUSEEXCHANGE_HPP
@@ -0,0 +1,259 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+#include "CubeAndConquer.hpp"
+#include "ClauseExchange.hpp"
+#include "Solver.hpp"
+#include "util/WorkQueue.hpp"
+
+namespace sat {
+
+    namespace {
+        struct Task {
+            Cube cube;
+            std::size_t budget; // conflicts before the cube is split
+        };
+
+        constexpr std::size_t Unlimited = std::numeric_limits<std::size_t>::max();
+    }
+
+    CubeSplitter::CubeSplitter(const inout::DimacsProblem &problem) {
+        std::vector<std::size_t> occurrences(problem.numVariables, 0);
+        for (Literal l : problem.literals) {
+            ++occurrences[var(l).get()];
+        }
+
+        for (unsigned x = 0; x < problem.numVariables; ++x) {
+            if (occurrences[x] > 0) {
+                mOrder.emplace_back(x);
+            }
+        }
+
+        std::ranges::stable_sort(mOrder, std::greater{}, [&occurrences](Variable x) { return occurrences[x.get()]; });
+    }
+
+    std::vector<Cube> CubeSplitter::split(Solver &solver, Cube cube) const {
+        std::optional<Variable> best;
+        std::size_t bestScore = 0;
+        std::size_t numCandidates = 0;
+        std::size_t numProbed = 0;
+        for (Variable x : mOrder) {
+            // Variables fixed by the cube cost lookaheads as well, so their number is bounded too
+            if (numCandidates == MaxCandidates || numProbed == 4 * MaxCandidates) {
+                break;
+            }
+
+            ++numProbed;
+            const auto positive = solver.lookahead(cube, pos(x));
+            const auto negative = solver.lookahead(cube, neg(x));
+            if (!positive && !negative) {
+                return {};
+            }
+
+            if (!positive || !negative) {
+                // Failed literal: the other polarity is implied by the cube
+                const Literal implied = positive ? pos(x) : neg(x);
+                if (*(positive ? positive : negative) > 0) {
+                    cube.push_back(implied);
+                }
+
+                continue;
+            }
+
+            if (*positive == 0 || *negative == 0) {
+                continue;
+            }
+
+            ++numCandidates;
+            const std::size_t score = *positive * *negative + *positive + *negative;
+            if (score > bestScore) {
+                bestScore = score;
+                best = x;
+            }
+        }
+
+        if (!best) {
+            return {std::move(cube)};
+        }
+
+        std::vector<Cube> parts(2, cube);
+        parts[0].push_back(pos(*best));
+        parts[1].push_back(neg(*best));
+        return parts;
+    }
+
+    std::vector<Cube> CubeSplitter::cubes(Solver &solver, std::size_t numCubes) const {
+        std::vector<Cube> cubes(1);
+        while (cubes.size() < numCubes) {
+            std::vector<Cube> next;
+            bool progress = false;
+            for (auto &cube : cubes) {
+                auto parts = split(solver, std::move(cube));
+                progress |= parts.size() != 1;
+                std::ranges::move(parts, std::back_inserter(next));
+            }
+
+            cubes = std::move(next);
+            if (!progress) {
+                break;
+            }
+        }
+
+        return cubes;
+    }
+
+    std::optional<CubeResult> solve_cubes(const inout::DimacsProblem &problem, const CubeOptions &options,
+                                          std::stop_token stop) {
+        const std::size_t numThreads = std::max<std::size_t>(options.numThreads, 1);
+        const auto numVariables = static_cast<unsigned>(problem.numVariables);
+        const CubeSplitter splitter(problem);
+        std::vector<Cube> initial;
+        {
+            Solver lookahead(numVariables);
+            if (!lookahead.addClauses(problem.clauses())) {
+                return CubeResult{false, {}};
+            }
+
+            initial = splitter.cubes(lookahead, numThreads * options.cubesPerThread);
+        }
+
+        std::vector<WorkQueue<Task>> queues(numThreads);
+        for (std::size_t i = 0; i < initial.size(); ++i) {
+            queues[i % numThreads].push(Task{initial[i], options.conflictBudget});
+        }
+
+        // Cubes that are queued or being solved. Subcubes are counted before their parent is removed
+        std::atomic<std::size_t> pending = initial.size();
+        std::atomic<std::size_t> solved = 0;
+        std::atomic<std::size_t> splits = 0;
+        std::atomic<std::size_t> steals = 0;
+        std::stop_source cancel;
+        std::stop_callback forward(stop, [&cancel] { cancel.request_stop(); });
+        std::mutex mutex;
+        std::optional<CubeResult> result;
+        std::exception_ptr error;
+        ClauseExchange exchange;
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(numThreads);
+            for (std::size_t i = 0; i < numThreads; ++i) {
+                workers.emplace_back([&, i] {
+                    try {
+                        Solver solver(numVariables);
+                        solver.setStopToken(cancel.get_token());
+                        std::optional<ExchangePort> port;
+                        if (options.shareClauses) {
+                            port.emplace(exchange, static_cast<unsigned>(i));
+                            solver.setExchange(&*port);
+                        }
+
+                        solver.addClauses(problem.clauses());
+                        auto finish = [&](bool satisfiable) {
+                            std::lock_guard lock(mutex);
+                            if (!result) {
+                                result = CubeResult{satisfiable, {}};
+                                for (unsigned x = 0; satisfiable && x < numVariables; ++x) {
+                                    result->model.push_back(solver.val(Variable(x)));
+                                }
+                            }
+
+                            cancel.request_stop();
+                        };
+
+                        while (!cancel.stop_requested()) {
+                            auto task = queues[i].pop();
+                            for (std::size_t k = 1; !task && k < numThreads; ++k) {
+                                task = queues[(i + k) % numThreads].steal();
+                                steals += task.has_value();
+                            }
+
+                            if (!task) {
+                                if (pending == 0) {
+                                    return;
+                                }
+
+                                // Another worker is still busy and may split its cube
+                                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                continue;
+                            }
+
+                            const std::size_t conflicts = solver.numConflicts();
+                            solver.setConflictLimit(task->budget > Unlimited - conflicts ?
+                                                    Unlimited : conflicts + task->budget);
+                            if (solver.solve(task->cube)) {
+                                ++solved;
+                                finish(true);
+                                return;
+                            }
+
+                            if (!solver.interrupted()) {
+                                ++solved;
+                                if (solver.failedAssumptions().empty()) {
+                                    // Refuted independently of the cube
+                                    finish(false);
+                                    return;
+                                }
+
+                                --pending;
+                                continue;
+                            }
+
+                            if (cancel.stop_requested()) {
+                                return;
+                            }
+
+                            // The cube exceeded its budget. If it cannot be split, it is solved without limit
+                            ++splits;
+                            auto parts = splitter.split(solver, std::move(task->cube));
+                            solved += parts.empty();
+                            const std::size_t budget = parts.size() == 1 ? Unlimited : 2 * task->budget;
+                            pending += parts.size();
+                            for (auto &part : parts) {
+                                queues[i].push(Task{std::move(part), budget});
+                            }
+
+                            --pending;
+                        }
+                    } catch (...) {
+                        std::lock_guard lock(mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+
+                        cancel.request_stop();
+                    }
+                });
+            }
+        } // joins all workers
+
+        if (!result && error) {
+            std::rethrow_exception(error);
+        }
+
+        if (!result) {
+            if (pending != 0) {
+                return std::nullopt;
+            }
+
+            // All cubes have been refuted
+            result = CubeResult{false, {}};
+        }
+
+        result->initialCubes = initial.size();
+        result->solvedCubes = solved;
+        result->splits = splits;
+        result->steals = steals;
+        return result;
+    }
+}
@@ -0,0 +1,101 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file CubeAndConquer.hpp
+* @brief Contains the parallel cube-and-conquer solver that splits a problem into cubes solved by a thread pool
+*/
+
+#ifndef CUBEANDCONQUER_HPP
+#define CUBEANDCONQUER_HPP
+
+#include <vector>
+#include <span>
+#include <optional>
+#include <stop_token>
+#include <cstddef>
+
+#include "basic_structures.hpp"
+#include "inout.hpp"
+
+namespace sat {
+    class Solver;
+
+    /**
+     * @brief A cube is a conjunction of literals that is solved as assumptions
+     */
+    using Cube = std::vector<Literal>;
+
+    /**
+     * @brief Splits cubes by lookahead.
+     * @details For a number of candidate variables (those with the most occurrences), both polarities are propagated
+     * under the cube (see Solver::lookahead). The variable whose polarities imply the most literals (product of both
+     * counts) is the split variable. Failed literals found on the way are added to the cube, if both polarities of a
+     * variable fail, the cube is refuted.
+     */
+    class CubeSplitter {
+        std::vector<Variable> mOrder; // variables by decreasing number of occurrences
+
+    public:
+        static constexpr std::size_t MaxCandidates = 32; ///< number of variables evaluated per split
+
+        /**
+         * Ctor
+         * @param problem the problem whose cubes are split
+         */
+        explicit CubeSplitter(const inout::DimacsProblem &problem);
+
+        /**
+         * Splits a cube into two
+         * @param solver solver containing the problem clauses
+         * @param cube the cube, may be extended by failed literals
+         * @return the two subcubes, a single cube if no split variable was found or none if the cube is refuted
+         */
+        std::vector<Cube> split(Solver &solver, Cube cube) const;
+
+        /**
+         * Splits the whole search space into cubes, level by level, until there are enough
+         * @param solver solver containing the problem clauses
+         * @param numCubes number of cubes to produce at least (unless the search space is exhausted)
+         * @return the cubes. Together, they cover all models of the problem
+         */
+        std::vector<Cube> cubes(Solver &solver, std::size_t numCubes) const;
+    };
+
+    /**
+     * @brief Parameters of the cube-and-conquer solver
+     */
+    struct CubeOptions {
+        std::size_t numThreads = 4; ///< number of worker threads
+        std::size_t cubesPerThread = 8; ///< number of initial cubes per thread
+        std::size_t conflictBudget = 1000; ///< conflicts per cube before it is split further (doubles on each split)
+        bool shareClauses = true; ///< whether the workers exchange learned clauses (see ClauseExchange)
+    };
+
+    /**
+     * @brief Outcome of a cube-and-conquer run
+     */
+    struct CubeResult {
+        bool satisfiable; ///< whether the problem is satisfiable
+        std::vector<TruthValue> model; ///< satisfying assignment of all variables, empty if unsatisfiable
+        std::size_t initialCubes = 0; ///< number of cubes produced by the lookahead phase
+        std::size_t solvedCubes = 0; ///< number of cubes refuted or satisfied by the workers
+        std::size_t splits = 0; ///< number of cubes that exceeded their conflict budget and were split again
+        std::size_t steals = 0; ///< number of cubes taken from the queue of another worker
+    };
+
+    /**
+     * Solves a problem by cube-and-conquer. A lookahead phase splits the problem into cubes which are distributed
+     * among the worker threads. Each worker has its own double-ended queue of cubes, it processes its newest cube
+     * first and steals the oldest cube of another worker if its queue is empty. Cubes that exceed the conflict budget
+     * are split again by the worker that processes them
+     * @param problem the problem to solve
+     * @param options parameters of the solver
+     * @param stop optional token that cancels the search
+     * @return the result or std::nullopt if the search was cancelled
+     * @throws the first exception thrown by any of the workers
+     */
+    std::optional<CubeResult> solve_cubes(const inout::DimacsProblem &problem, const CubeOptions &options,
+                                          std::stop_token stop = {});
+}
+
+#endif //CUBEANDCONQUER_HPP
@@ -0,0 +1,382 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+#include "GaussJordan.hpp"
+
+namespace sat {
+
+    std::vector<XorConstraint> recover_xors(const std::vector<std::vector<Literal>> &clauses, std::size_t maxSize) {
+        // Clauses over the same variables are grouped. Each clause is identified by the signs of its literals in the
+        // order of the variables (bit i set: i-th literal is negative)
+        assert(maxSize < 32);
+        std::vector<std::pair<std::vector<unsigned>, std::uint32_t>> candidates;
+        for (const auto &clause : clauses) {
+            if (clause.size() < 2 || clause.size() > maxSize) {
+                continue;
+            }
+
+            std::vector<Literal> sorted = clause;
+            std::ranges::sort(sorted, {}, [](Literal l) { return var(l).get(); });
+            auto &[variables, negative] = candidates.emplace_back();
+            negative = 0;
+            for (std::size_t i = 0; i < sorted.size(); ++i) {
+                variables.push_back(var(sorted[i]).get());
+                if (sorted[i].sign() < 0) {
+                    negative |= std::uint32_t(1) << i;
+                }
+            }
+        }
+
+        std::ranges::sort(candidates);
+        const auto [first, last] = std::ranges::unique(candidates);
+        candidates.erase(first, last);
+        std::vector<XorConstraint> xors;
+        for (std::size_t begin = 0, end = 0; begin < candidates.size(); begin = end) {
+            const auto &variables = candidates[begin].first;
+            std::size_t numEven = 0;
+            std::size_t numOdd = 0;
+            for (end = begin; end < candidates.size() && candidates[end].first == variables; ++end) {
+                ++(std::popcount(candidates[end].second) % 2 == 0 ? numEven : numOdd);
+            }
+
+            const std::size_t required = std::size_t(1) << (variables.size() - 1);
+            for (bool parity : {true, false}) {
+                // Clauses with an even number of negative literals exclude assignments with even parity
+                if ((parity ? numEven : numOdd) == required) {
+                    auto &constraint = xors.emplace_back();
+                    constraint.parity = parity;
+                    std::ranges::transform(variables, std::back_inserter(constraint.variables), [](unsigned x) {
+                        return Variable(x);
+                    });
+                }
+            }
+        }
+
+        return xors;
+    }
+
+    GaussJordan::GaussJordan(std::span<const XorConstraint> xors, std::size_t numVariables) :
+        mColumns(numVariables, None) {
+        for (const auto &constraint : xors) {
+            for (Variable x : constraint.variables) {
+                if (mColumns[x.get()] == None) {
+                    mColumns[x.get()] = static_cast<std::uint32_t>(mVariables.size());
+                    mVariables.push_back(x);
+                }
+            }
+        }
+
+        const std::size_t numColumns = mVariables.size();
+        mWords = (numColumns + 63) / 64;
+        mNumRows = xors.size();
+        mMatrix.assign(mNumRows * mWords, 0);
+        mParity.assign(mNumRows, 0);
+        for (std::size_t r = 0; r < mNumRows; ++r) {
+            for (Variable x : xors[r].variables) {
+                const std::uint32_t column = mColumns[x.get()];
+                row(r)[column / 64] ^= std::uint64_t(1) << (column % 64);
+            }
+
+            mParity[r] = xors[r].parity;
+        }
+
+        // Gauss-Jordan elimination: the pivot of each column is eliminated from all other rows
+        std::size_t rank = 0;
+        for (std::uint32_t column = 0; column < numColumns && rank < mNumRows; ++column) {
+            std::size_t pivotRow = rank;
+            while (pivotRow < mNumRows && !contains(pivotRow, column)) {
+                ++pivotRow;
+            }
+
+            if (pivotRow == mNumRows) {
+                continue;
+            }
+
+            std::swap_ranges(row(pivotRow), row(pivotRow) + mWords, row(rank));
+            std::swap(mParity[pivotRow], mParity[rank]);
+            for (std::size_t r = 0; r < mNumRows; ++r) {
+                if (r != rank && contains(r, column)) {
+                    addRow(r, rank);
+                }
+            }
+
+            mBasic.push_back(column);
+            ++rank;
+        }
+
+        // The remaining rows are empty, 0 = 1 means the constraints have no solution
+        mInconsistent = std::any_of(mParity.begin() + static_cast<std::ptrdiff_t>(rank), mParity.end(),
+                                    [](std::uint8_t parity) { return parity != 0; });
+
+        // Rows with a single column are unit facts, they are dropped together with the empty rows
+        std::size_t numRows = 0;
+        for (std::size_t r = 0; r < rank; ++r) {
+            std::size_t numColumnsInRow = 0;
+            for (std::size_t w = 0; w < mWords; ++w) {
+                numColumnsInRow += static_cast<std::size_t>(std::popcount(row(r)[w]));
+            }
+
+            if (numColumnsInRow == 1) {
+                const Variable x = mVariables[mBasic[r]];
+                mUnits.push_back(mParity[r] != 0 ? pos(x) : neg(x));
+                continue;
+            }
+
+            std::copy(row(r), row(r) + mWords, row(numRows));
+            mParity[numRows] = mParity[r];
+            mBasic[numRows] = mBasic[r];
+            ++numRows;
+        }
+
+        mNumRows = numRows;
+        mMatrix.resize(mNumRows * mWords);
+        mParity.resize(mNumRows);
+        mBasic.resize(mNumRows);
+        mWatchers.resize(numColumns);
+        mPending.assign(numColumns, TruthValue::Undefined);
+        mStamps.assign(numColumns, 0);
+        for (std::uint32_t r = 0; r < mNumRows; ++r) {
+            mWatch.push_back(findUnassigned(r, mBasic[r], None));
+            assert(mWatch.back() != None);
+            mWatchers[mBasic[r]].push_back(r);
+            mWatchers[mWatch.back()].push_back(r);
+        }
+    }
+
+    std::uint64_t *GaussJordan::row(std::size_t r) {
+        return mMatrix.data() + r * mWords;
+    }
+
+    const std::uint64_t *GaussJordan::row(std::size_t r) const {
+        return mMatrix.data() + r * mWords;
+    }
+
+    bool GaussJordan::contains(std::size_t r, std::uint32_t column) const {
+        return (row(r)[column / 64] >> (column % 64) & 1) != 0;
+    }
+
+    TruthValue GaussJordan::value(std::uint32_t column) const {
+        if (mPending[column] != TruthValue::Undefined) {
+            return mPending[column];
+        }
+
+        // Without a model, all variables are unassigned (used during construction)
+        return mModel.empty() ? TruthValue::Undefined : mModel[mVariables[column].get()];
+    }
+
+    std::uint32_t GaussJordan::findUnassigned(std::size_t r, std::uint32_t exclude1, std::uint32_t exclude2) const {
+        const std::uint64_t *bits = row(r);
+        for (std::size_t w = 0; w < mWords; ++w) {
+            for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+                const auto column = static_cast<std::uint32_t>(w * 64 +
+                                                               static_cast<std::size_t>(std::countr_zero(word)));
+                if (column != exclude1 && column != exclude2 && value(column) == TruthValue::Undefined) {
+                    return column;
+                }
+            }
+        }
+
+        return None;
+    }
+
+    void GaussJordan::addRow(std::size_t dst, std::size_t src) {
+        std::uint64_t *target = row(dst);
+        const std::uint64_t *source = row(src);
+        for (std::size_t w = 0; w < mWords; ++w) {
+            target[w] ^= source[w];
+        }
+
+        mParity[dst] ^= mParity[src];
+    }
+
+    void GaussJordan::pivot(std::size_t r, std::uint32_t column) {
+        ++mNumPivots;
+        for (std::size_t other = 0; other < mNumRows; ++other) {
+            if (other != r && contains(other, column)) {
+                addRow(other, r);
+                mWorklist.push_back(static_cast<std::uint32_t>(other));
+            }
+        }
+
+        mBasic[r] = column;
+        mWatchers[column].push_back(static_cast<std::uint32_t>(r));
+    }
+
+    bool GaussJordan::settle(std::size_t r) {
+        std::uint32_t unassigned = None;
+        std::uint32_t latest = None;
+        bool parity = mParity[r] != 0;
+        const std::uint64_t *bits = row(r);
+        for (std::size_t w = 0; w < mWords; ++w) {
+            for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+                const auto column = static_cast<std::uint32_t>(w * 64 +
+                                                               static_cast<std::size_t>(std::countr_zero(word)));
+                const TruthValue val = value(column);
+                if (val == TruthValue::Undefined) {
+                    assert(unassigned == None);
+                    unassigned = column;
+                } else {
+                    parity ^= val == TruthValue::True;
+                    if (column != mBasic[r] && (latest == None || mStamps[column] > mStamps[latest])) {
+                        latest = column;
+                    }
+                }
+            }
+        }
+
+        // The basic column is watched anyway, the other watch is the unassigned column if there is one
+        const std::uint32_t watch = unassigned == None || unassigned == mBasic[r] ? latest : unassigned;
+        if (watch != mWatch[r]) {
+            mWatch[r] = watch;
+            mWatchers[watch].push_back(static_cast<std::uint32_t>(r));
+        }
+
+        // The explanation consists of the negated values of all assigned variables of the row
+        auto explain = [this, bits](std::vector<Literal> &explanation, std::uint32_t skip) {
+            for (std::size_t w = 0; w < mWords; ++w) {
+                for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+                    const auto column = static_cast<std::uint32_t>(w * 64 +
+                                                                   static_cast<std::size_t>(std::countr_zero(word)));
+                    if (column != skip) {
+                        const Variable x = mVariables[column];
+                        explanation.push_back(value(column) == TruthValue::True ? neg(x) : pos(x));
+                    }
+                }
+            }
+        };
+
+        if (unassigned == None) {
+            if (!parity) {
+                return true;
+            }
+
+            explain(mConflict, None);
+            return false;
+        }
+
+        // The remaining variable has to make up for the parity of the others
+        const Variable x = mVariables[unassigned];
+        mExplanations.push_back(parity ? pos(x) : neg(x));
+        explain(mExplanations, unassigned);
+        mExplanationEnds.push_back(mExplanations.size());
+        mPending[unassigned] = parity ? TruthValue::True : TruthValue::False;
+        mPendingColumns.push_back(unassigned);
+        mStamps[unassigned] = ++mTime;
+        return true;
+    }
+
+    bool GaussJordan::update(std::size_t r) {
+        const std::uint32_t basic = mBasic[r];
+        const std::uint32_t first = findUnassigned(r, basic, None);
+        const std::uint32_t second = first == None ? None : findUnassigned(r, basic, first);
+        if (value(basic) == TruthValue::Undefined) {
+            if (first == None) {
+                return settle(r);
+            }
+
+            if (!contains(r, mWatch[r]) || value(mWatch[r]) != TruthValue::Undefined) {
+                mWatch[r] = first;
+                mWatchers[first].push_back(static_cast<std::uint32_t>(r));
+            }
+
+            return true;
+        }
+
+        if (second == None) {
+            return settle(r);
+        }
+
+        // Two unassigned columns: one becomes the watch (the current one if possible), the other one basic
+        const std::uint32_t watch = mWatch[r];
+        if (watch != first && watch != second) {
+            mWatch[r] = first;
+            mWatchers[first].push_back(static_cast<std::uint32_t>(r));
+        }
+
+        pivot(r, mWatch[r] == first ? second : first);
+        return true;
+    }
+
+    bool GaussJordan::inconsistent() const noexcept {
+        return mInconsistent;
+    }
+
+    const std::vector<Literal> &GaussJordan::units() const noexcept {
+        return mUnits;
+    }
+
+    std::size_t GaussJordan::numRows() const noexcept {
+        return mNumRows;
+    }
+
+    std::size_t GaussJordan::numPivots() const noexcept {
+        return mNumPivots;
+    }
+
+    bool GaussJordan::assign(Variable x, std::span<const TruthValue> model) {
+        mModel = model;
+        mExplanations.clear();
+        mExplanationEnds.clear();
+        mConflict.clear();
+        const std::uint32_t column = mColumns[x.get()];
+        if (column == None) {
+            return true;
+        }
+
+        // Entries of rows that do not watch the column anymore are dropped. Rows that start watching the column
+        // during the loop are appended and not visited, since the assignment has been taken into account already
+        mStamps[column] = ++mTime;
+        bool ok = true;
+        auto &watchers = mWatchers[column];
+        const std::size_t numWatchers = watchers.size();
+        std::size_t keep = 0;
+        for (std::size_t next = 0; next < numWatchers; ++next) {
+            const std::uint32_t r = watchers[next];
+            if (mBasic[r] != column && mWatch[r] != column) {
+                continue;
+            }
+
+            // Each pivot turns an assigned basic variable into an unassigned one, so the worklist runs empty
+            mWorklist.push_back(r);
+            while (ok && !mWorklist.empty()) {
+                const std::uint32_t current = mWorklist.back();
+                mWorklist.pop_back();
+                ok = update(current);
+            }
+
+            mWorklist.clear();
+            if (mBasic[r] == column || mWatch[r] == column) {
+                watchers[keep++] = r;
+            }
+        }
+
+        watchers.erase(watchers.begin() + static_cast<std::ptrdiff_t>(keep),
+                       watchers.begin() + static_cast<std::ptrdiff_t>(numWatchers));
+        for (std::uint32_t pending : mPendingColumns) {
+            mPending[pending] = TruthValue::Undefined;
+        }
+
+        mPendingColumns.clear();
+        return ok;
+    }
+
+    std::size_t GaussJordan::numImplied() const noexcept {
+        return mExplanationEnds.size();
+    }
+
+    std::span<const Literal> GaussJordan::implied(std::size_t i) const {
+        const std::size_t begin = i == 0 ? 0 : mExplanationEnds[i - 1];
+        return std::span(mExplanations).subspan(begin, mExplanationEnds[i] - begin);
+    }
+
+    std::span<const Literal> GaussJordan::conflict() const noexcept {
+        return mConflict;
+    }
+}
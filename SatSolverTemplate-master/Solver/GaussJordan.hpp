@@ -0,0 +1,174 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file GaussJordan.hpp
+* @brief Contains the recovery of XOR constraints from clauses and their propagation by Gauss-Jordan elimination
+*/
+
+#ifndef GAUSSJORDAN_HPP
+#define GAUSSJORDAN_HPP
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Parity constraint x1 xor ... xor xk = parity
+     */
+    struct XorConstraint {
+        std::vector<Variable> variables; // Distinct variables, sorted by id
+        bool parity;
+    };
+
+    /**
+     * Finds XOR constraints encoded in CNF. A constraint over k variables is encoded by the 2^(k-1) clauses over these
+     * variables that each exclude one assignment of the wrong parity. Clauses with an even number of negative literals
+     * exclude assignments with an even number of true variables and vice versa
+     * @param clauses clauses free of duplicate literals and tautologies
+     * @param maxSize constraints with more variables are not searched for
+     * @return all constraints whose encoding is fully contained in the clauses
+     */
+    std::vector<XorConstraint> recover_xors(const std::vector<std::vector<Literal>> &clauses, std::size_t maxSize);
+
+    /**
+     * @brief Propagation of a system of XOR constraints during search
+     * @details The constraints are the rows of a bit matrix over GF(2) with one column per variable, where each row is
+     * packed into 64-bit words, so adding one row to another is a loop of word-wise XORs the compiler vectorizes. The
+     * matrix is brought into reduced row echelon form once (Gauss-Jordan elimination): each row has a basic column
+     * that occurs in no other row. A system without solution is detected right away, rows with a single column are
+     * unit facts (see units()).
+     *
+     * During search, each row watches its basic column and one other column, similar to the two watched literals of
+     * clauses. If the basic variable of a row is assigned, another unassigned column of the row becomes basic and is
+     * eliminated from all other rows (pivoting), so as long as possible the basic variables are unassigned. A row
+     * propagates once all but one of its variables are assigned. Every implication and conflict comes with an
+     * explanation clause that is implied by the constraints: the implied literal and the negation of the current
+     * values of all other variables of the row.
+     */
+    class GaussJordan {
+    public:
+        static constexpr std::uint32_t None = std::numeric_limits<std::uint32_t>::max();
+
+    private:
+        std::size_t mNumRows = 0;
+        std::size_t mWords = 0;                            // 64-bit words per row
+        std::vector<std::uint64_t> mMatrix;                // Row-major packed matrix
+        std::vector<std::uint8_t> mParity;                 // Right-hand side of each row
+        std::vector<Variable> mVariables;                  // Variable of each column
+        std::vector<std::uint32_t> mColumns;               // Column of each variable, None if not in any row
+        std::vector<std::uint32_t> mBasic;                 // Basic column of each row
+        std::vector<std::uint32_t> mWatch;                 // Watched non-basic column of each row
+        std::vector<std::vector<std::uint32_t>> mWatchers; // Rows watching each column, may contain stale entries
+        std::vector<std::uint64_t> mStamps;                // Time of the last assignment of each column
+        std::uint64_t mTime = 0;
+        std::vector<TruthValue> mPending;                  // Values implied during the current call to assign()
+        std::vector<std::uint32_t> mPendingColumns;
+        std::vector<std::uint32_t> mWorklist;              // Rows that have to be updated
+        std::span<const TruthValue> mModel;
+        std::vector<Literal> mExplanations;                // Explanation clauses of assign(), stored back to back
+        std::vector<std::size_t> mExplanationEnds;
+        std::vector<Literal> mConflict;
+        std::vector<Literal> mUnits;
+        std::size_t mNumPivots = 0;
+        bool mInconsistent = false;
+
+        std::uint64_t *row(std::size_t r);
+        const std::uint64_t *row(std::size_t r) const;
+        bool contains(std::size_t r, std::uint32_t column) const;
+        TruthValue value(std::uint32_t column) const;
+
+        /**
+         * First unassigned column of a row other than the given ones
+         * @return the column or None
+         */
+        std::uint32_t findUnassigned(std::size_t r, std::uint32_t exclude1, std::uint32_t exclude2) const;
+
+        /**
+         * Adds row src to row dst
+         */
+        void addRow(std::size_t dst, std::size_t src);
+
+        /**
+         * Makes a column basic in the given row by adding the row to all other rows containing the column. The
+         * modified rows are queued in the worklist
+         */
+        void pivot(std::size_t r, std::uint32_t column);
+
+        /**
+         * Propagates a row with at most one unassigned variable. Afterwards, the row watches the unassigned column
+         * and the most recently assigned one, so that backtracking unassigns the watched columns first
+         * @return false if the row is falsified
+         */
+        bool settle(std::size_t r);
+
+        /**
+         * Restores the watches of a row after an assignment or a pivot: if the row has at least two unassigned
+         * columns, both its basic and its watched column are unassigned afterwards, pivoting if necessary. Otherwise,
+         * the row is settled
+         * @return false if the row is falsified
+         */
+        bool update(std::size_t r);
+
+    public:
+        /**
+         * Ctor. Builds the matrix and runs Gauss-Jordan elimination
+         * @param xors the constraints
+         * @param numVariables number of variables of the problem
+         */
+        GaussJordan(std::span<const XorConstraint> xors, std::size_t numVariables);
+
+        /**
+         * Whether the constraints have no solution
+         */
+        bool inconsistent() const noexcept;
+
+        /**
+         * Literals implied by the constraints alone
+         */
+        const std::vector<Literal> &units() const noexcept;
+
+        /**
+         * Number of independent constraints without the unit facts
+         */
+        std::size_t numRows() const noexcept;
+
+        /**
+         * Number of pivots during search so far
+         */
+        std::size_t numPivots() const noexcept;
+
+        /**
+         * Notifies the engine that a variable has been assigned. Must be called for every assigned variable right
+         * after its assignment, unassignments require no notification
+         * @param x the assigned variable
+         * @param model current assignment of all variables
+         * @return false if a constraint is falsified, see conflict(). The implied literals (see numImplied()) have to
+         * be assigned in the order of their explanations, since later explanations may contain earlier ones
+         */
+        bool assign(Variable x, std::span<const TruthValue> model);
+
+        /**
+         * Number of literals implied by the last call to assign()
+         */
+        std::size_t numImplied() const noexcept;
+
+        /**
+         * Explanation of the i-th literal implied by the last call to assign(). The implied literal comes first, all
+         * other literals are falsified by the model and the previously implied literals
+         */
+        std::span<const Literal> implied(std::size_t i) const;
+
+        /**
+         * Explanation of the conflict found by the last call to assign(). All literals are falsified
+         */
+        std::span<const Literal> conflict() const noexcept;
+    };
+}
+
+#endif //GAUSSJORDAN_HPP
@@ -0,0 +1,260 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "LratChecker.hpp"
+#include "inout.hpp"
+
+namespace sat {
+
+    namespace {
+        constexpr long long MaxId = std::numeric_limits<long long>::max() / 10;
+
+        std::runtime_error lemmaError(std::uint64_t id, const std::string &what) {
+            return std::runtime_error("lemma " + std::to_string(id) + ": " + what);
+        }
+    }
+
+    void LratChecker::header(std::size_t numVariables, std::size_t numClauses) {
+        mNumVariables = numVariables;
+        mAssigned.assign(2 * numVariables, 0);
+        mClauses.assign(1, Entry{0, 0, false});
+        mClauses.reserve(numClauses + 1);
+    }
+
+    void LratChecker::literal(Literal l) {
+        mClause.push_back(l);
+    }
+
+    void LratChecker::endClause() {
+        clause(mClause);
+        mClause.clear();
+    }
+
+    void LratChecker::clause(std::span<const Literal> literals) {
+        if (mClauses.empty()) {
+            throw std::runtime_error("no problem header found");
+        }
+
+        store(literals);
+    }
+
+    void LratChecker::store(std::span<const Literal> clause) {
+        const std::size_t begin = mLiterals.size();
+        mLiterals.insert(mLiterals.end(), clause.begin(), clause.end());
+        // Duplicate literals would prevent clauses from becoming unit
+        std::sort(mLiterals.begin() + begin, mLiterals.end(), [](Literal a, Literal b) { return a.get() < b.get(); });
+        mLiterals.erase(std::unique(mLiterals.begin() + begin, mLiterals.end()), mLiterals.end());
+        mClauses.push_back(Entry{begin, static_cast<std::uint32_t>(mLiterals.size() - begin), true});
+    }
+
+    bool LratChecker::isTrue(Literal l) const {
+        return mAssigned[l.get()] == mStamp;
+    }
+
+    void LratChecker::checkVariable(Literal l) const {
+        if (var(l).get() >= mNumVariables) {
+            throw std::runtime_error("literal of undeclared variable " + std::to_string(inout::to_dimacs(l)));
+        }
+    }
+
+    void LratChecker::addLemma(std::uint64_t id, std::span<const Literal> clause,
+                               std::span<const std::int64_t> hints) {
+        if (id < mClauses.size()) {
+            throw lemmaError(id, "ids must be increasing");
+        }
+
+        ++mStamp;
+        bool tautology = false;
+        for (Literal l : clause) {
+            checkVariable(l);
+            tautology |= isTrue(l);
+            mAssigned[l.negate().get()] = mStamp;
+        }
+
+        bool conflict = tautology;
+        for (std::size_t i = 0; i < hints.size() && !conflict; ++i) {
+            if (hints[i] < 0) {
+                throw lemmaError(id, "RAT steps are not supported");
+            }
+
+            const auto hintId = static_cast<std::uint64_t>(hints[i]);
+            if (hintId >= mClauses.size() || !mClauses[hintId].active) {
+                throw lemmaError(id, "hint " + std::to_string(hintId) + " refers to an unknown or deleted clause");
+            }
+
+            const auto hint = std::span(mLiterals).subspan(mClauses[hintId].begin, mClauses[hintId].size);
+            std::size_t numOpen = 0;
+            Literal open = 0;
+            for (Literal q : hint) {
+                if (isTrue(q)) {
+                    throw lemmaError(id, "hint " + std::to_string(hintId) + " is satisfied");
+                }
+
+                if (!isTrue(q.negate())) {
+                    ++numOpen;
+                    open = q;
+                }
+            }
+
+            if (numOpen > 1) {
+                throw lemmaError(id, "hint " + std::to_string(hintId) + " is not unit");
+            }
+
+            if (numOpen == 0) {
+                conflict = true;
+            } else {
+                mAssigned[open.get()] = mStamp;
+            }
+        }
+
+        if (!conflict) {
+            throw lemmaError(id, "hints do not lead to a conflict");
+        }
+
+        mClauses.resize(id, Entry{0, 0, false});
+        store(clause);
+        ++mNumLemmas;
+        mRefuted |= clause.empty();
+    }
+
+    void LratChecker::remove(std::uint64_t id) {
+        if (id >= mClauses.size() || !mClauses[id].active) {
+            throw std::runtime_error("deletion of unknown clause " + std::to_string(id));
+        }
+
+        mClauses[id].active = false;
+        mWasted += mClauses[id].size;
+        if (mWasted > mLiterals.size() / 2) {
+            // Entries are ordered by their position in mLiterals, so the literals can be moved down in place
+            std::size_t end = 0;
+            for (auto &entry : mClauses) {
+                if (entry.active) {
+                    std::copy_n(mLiterals.begin() + entry.begin, entry.size, mLiterals.begin() + end);
+                    entry.begin = end;
+                    end += entry.size;
+                }
+            }
+
+            mLiterals.erase(mLiterals.begin() + static_cast<std::ptrdiff_t>(end), mLiterals.end());
+            mWasted = 0;
+        }
+    }
+
+    void LratChecker::checkText(std::string_view proof) {
+        detail::DimacsScanner scanner(proof);
+        while (scanner.skipWhitespace()) {
+            if (scanner.peek() == 'c') {
+                scanner.skipLine();
+                continue;
+            }
+
+            const auto id = static_cast<std::uint64_t>(scanner.readInt(MaxId));
+            if (!scanner.skipWhitespace()) {
+                throw std::runtime_error("truncated proof");
+            }
+
+            if (scanner.peek() == 'd') {
+                scanner.expect("d");
+                for (auto deleted = scanner.readInt(MaxId); deleted != 0; deleted = scanner.readInt(MaxId)) {
+                    remove(static_cast<std::uint64_t>(deleted));
+                }
+
+                continue;
+            }
+
+            mClause.clear();
+            for (auto lit = scanner.readInt(); lit != 0; lit = scanner.readInt()) {
+                mClause.push_back(inout::from_dimacs(static_cast<int>(lit)));
+            }
+
+            mHints.clear();
+            for (auto hint = scanner.readInt(MaxId); hint != 0; hint = scanner.readInt(MaxId)) {
+                mHints.push_back(hint);
+            }
+
+            addLemma(id, mClause, mHints);
+        }
+    }
+
+    void LratChecker::checkBinary(std::string_view proof) {
+        std::size_t pos = 0;
+        auto next = [&proof, &pos]() -> std::int64_t {
+            std::uint64_t mapped = 0;
+            for (unsigned shift = 0; ; shift += 7) {
+                if (pos == proof.size()) {
+                    throw std::runtime_error("truncated proof");
+                }
+
+                if (shift > 56) {
+                    throw std::runtime_error("integer out of range");
+                }
+
+                const auto byte = static_cast<unsigned char>(proof[pos++]);
+                mapped |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+                if (!(byte & 0x80)) {
+                    break;
+                }
+            }
+
+            const auto value = static_cast<std::int64_t>(mapped >> 1);
+            return mapped & 1 ? -value : value;
+        };
+
+        while (pos < proof.size()) {
+            const char kind = proof[pos++];
+            if (kind == 'd') {
+                for (auto deleted = next(); deleted != 0; deleted = next()) {
+                    remove(static_cast<std::uint64_t>(deleted));
+                }
+            } else if (kind == 'a') {
+                const auto id = next();
+                mClause.clear();
+                for (auto lit = next(); lit != 0; lit = next()) {
+                    if (lit > std::numeric_limits<int>::max() || lit < -std::numeric_limits<int>::max()) {
+                        throw std::runtime_error("integer out of range");
+                    }
+
+                    mClause.push_back(inout::from_dimacs(static_cast<int>(lit)));
+                }
+
+                mHints.clear();
+                for (auto hint = next(); hint != 0; hint = next()) {
+                    mHints.push_back(hint);
+                }
+
+                addLemma(static_cast<std::uint64_t>(id), mClause, mHints);
+            } else {
+                throw std::runtime_error("invalid format");
+            }
+        }
+    }
+
+    void LratChecker::check(std::string_view proof) {
+        if (mClauses.empty()) {
+            throw std::runtime_error("no problem header found");
+        }
+
+        // Lines of textual proofs start with a clause id or a comment
+        if (!proof.empty() && (proof.front() == 'a' || proof.front() == 'd')) {
+            checkBinary(proof);
+        } else {
+            checkText(proof);
+        }
+    }
+
+    bool LratChecker::refuted() const {
+        return mRefuted;
+    }
+
+    std::size_t LratChecker::numLemmas() const {
+        return mNumLemmas;
+    }
+}
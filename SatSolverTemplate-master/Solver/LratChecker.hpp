@@ -0,0 +1,105 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file LratChecker.hpp
+* @brief Contains a checker for LRAT proofs of unsatisfiability
+*/
+
+#ifndef LRATCHECKER_HPP
+#define LRATCHECKER_HPP
+
+#include <vector>
+#include <span>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Checks LRAT proofs (see ProofFormat) against a CNF formula.
+     * @details The problem clauses are passed in first using the dimacs_sink interface and receive the ids 1, 2, ...
+     * Each lemma is then checked by falsifying its literals and propagating only the hint clauses, in the given order,
+     * each of which must become unit or falsified. This takes time linear in the size of the hints, independent of
+     * the size of the clause database. Deletions by RAT (negative hints) are not supported.
+     */
+    class LratChecker {
+        struct Entry {
+            std::size_t begin;
+            std::uint32_t size;
+            bool active;
+        };
+
+        std::size_t mNumVariables = 0;
+        std::vector<Literal> mLiterals;
+        std::vector<Entry> mClauses; // indexed by clause id
+        std::size_t mWasted = 0;
+        std::vector<std::uint64_t> mAssigned; // per literal: true if equal to mStamp
+        std::uint64_t mStamp = 0;
+        std::vector<Literal> mClause;
+        std::vector<std::int64_t> mHints;
+        std::size_t mNumLemmas = 0;
+        bool mRefuted = false;
+
+        void store(std::span<const Literal> clause);
+
+        bool isTrue(Literal l) const;
+
+        void checkVariable(Literal l) const;
+
+        void checkText(std::string_view proof);
+
+        void checkBinary(std::string_view proof);
+
+    public:
+        /**
+         * @name dimacs_sink interface
+         * @{
+         */
+        void header(std::size_t numVariables, std::size_t numClauses);
+
+        void literal(Literal l);
+
+        void endClause();
+
+        void clause(std::span<const Literal> literals);
+        /** @} */
+
+        /**
+         * Checks a lemma and adds it to the clause database
+         * @param id id of the lemma. Must be larger than all previous ids
+         * @param clause literals of the lemma
+         * @param hints ids of the clauses that imply the lemma by unit propagation
+         * @throws std::runtime_error if the lemma cannot be verified
+         */
+        void addLemma(std::uint64_t id, std::span<const Literal> clause, std::span<const std::int64_t> hints);
+
+        /**
+         * Removes a clause from the clause database
+         * @param id id of the clause
+         * @throws std::runtime_error if there is no such clause
+         */
+        void remove(std::uint64_t id);
+
+        /**
+         * Checks all steps of a textual or binary LRAT proof. The format is detected automatically
+         * @param proof contents of the proof file
+         * @throws std::runtime_error if the proof is malformed or a step cannot be verified
+         */
+        void check(std::string_view proof);
+
+        /**
+         * Whether the empty clause has been derived, i.e. the formula has been proven to be unsatisfiable
+         */
+        bool refuted() const;
+
+        /**
+         * Number of verified lemmas
+         */
+        std::size_t numLemmas() const;
+    };
+}
+
+#endif //LRATCHECKER_HPP
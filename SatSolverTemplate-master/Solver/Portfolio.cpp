@@ -0,0 +1,135 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <thread>
+#include <mutex>
+#include <exception>
+
+#include "Portfolio.hpp"
+#include "Solver.hpp"
+#include "util/random.hpp"
+
+namespace sat {
+
+    void SolverConfig::apply(Solver &solver) const {
+        switch (branching) {
+            case Branching::Activity:
+                solver.setHeuristic(Heuristic{});
+                break;
+            case Branching::FirstVariable:
+                solver.setHeuristic(FirstVariable{});
+                break;
+            case Branching::RandomVariable:
+                solver.setHeuristic(RandomVariable{seed});
+                break;
+        }
+
+        solver.setRestartPolicy(restarts);
+        solver.setPolarity(polarity);
+        solver.useTargetPhases(targetPhases);
+    }
+
+    std::vector<SolverConfig> portfolio_configs(std::size_t numWorkers) {
+        // Activity based members are by far the strongest, the simple heuristics only add diversity
+        static constexpr SolverConfig Base[] = {
+            {0, Branching::Activity, RestartPolicy::Glucose, Polarity::Positive, true},
+            {0, Branching::Activity, RestartPolicy::Luby, Polarity::Negative, true},
+            {0, Branching::Activity, RestartPolicy::Glucose, Polarity::Random, false},
+            {0, Branching::Activity, RestartPolicy::Luby, Polarity::Positive, false},
+            {0, Branching::RandomVariable, RestartPolicy::Glucose, Polarity::Random, true},
+            {0, Branching::FirstVariable, RestartPolicy::Luby, Polarity::Negative, true},
+        };
+
+        std::vector<SolverConfig> configs;
+        configs.reserve(numWorkers);
+        for (std::size_t i = 0; i < numWorkers; ++i) {
+            SolverConfig config = Base[i % std::size(Base)];
+            config.seed = static_cast<unsigned>(i);
+            if (i >= std::size(Base)) {
+                // Further members differ by their seed, which only matters for random polarities
+                config.branching = Branching::Activity;
+                config.polarity = Polarity::Random;
+            }
+
+            configs.push_back(config);
+        }
+
+        return configs;
+    }
+
+    std::optional<PortfolioResult> solve_portfolio(const inout::DimacsProblem &problem,
+                                                   std::span<const SolverConfig> configs, bool shareClauses,
+                                                   std::stop_token stop) {
+        std::stop_source cancel;
+        std::stop_callback forward(stop, [&cancel] { cancel.request_stop(); });
+        std::mutex mutex;
+        std::optional<PortfolioResult> result;
+        std::exception_ptr error;
+        ClauseExchange exchange;
+        std::vector<ExchangeStats> exchangeStats(shareClauses ? configs.size() : 0);
+        {
+            std::vector<std::jthread> workers;
+            workers.reserve(configs.size());
+            for (std::size_t i = 0; i < configs.size(); ++i) {
+                workers.emplace_back([&, i] {
+                    try {
+                        const SolverConfig &config = configs[i];
+                        RNG::get().setSeed(config.seed);
+                        Solver solver(static_cast<unsigned>(problem.numVariables));
+                        solver.setStopToken(cancel.get_token());
+                        config.apply(solver);
+                        std::optional<ExchangePort> port;
+                        if (shareClauses) {
+                            port.emplace(exchange, static_cast<unsigned>(i));
+                            solver.setExchange(&*port);
+                        }
+
+                        const bool sat = solver.addClauses(problem.clauses()) && solver.solve();
+                        if (port) {
+                            exchangeStats[i] = port->stats();
+                        }
+
+                        if (solver.interrupted()) {
+                            return;
+                        }
+
+                        std::lock_guard lock(mutex);
+                        if (result) {
+                            return;
+                        }
+
+                        result = PortfolioResult{sat, {}, i, solver.numConflicts(), {}};
+                        if (sat) {
+                            result->model.reserve(problem.numVariables);
+                            for (unsigned x = 0; x < problem.numVariables; ++x) {
+                                result->model.push_back(solver.val(Variable(x)));
+                            }
+                        }
+
+                        cancel.request_stop();
+                    } catch (...) {
+                        std::lock_guard lock(mutex);
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+
+                        cancel.request_stop();
+                    }
+                });
+            }
+        } // joins all workers
+
+        if (!result && error) {
+            std::rethrow_exception(error);
+        }
+
+        if (result) {
+            result->exchange = std::move(exchangeStats);
+        }
+
+        return result;
+    }
+}
@@ -0,0 +1,87 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file Portfolio.hpp
+* @brief Contains the parallel portfolio solver that runs differently configured solvers on the same problem
+*/
+
+#ifndef PORTFOLIO_HPP
+#define PORTFOLIO_HPP
+
+#include <vector>
+#include <span>
+#include <optional>
+#include <stop_token>
+#include <cstddef>
+
+#include "basic_structures.hpp"
+#include "heuristics.hpp"
+#include "restarts.hpp"
+#include "inout.hpp"
+#include "ClauseExchange.hpp"
+#include "util/enum.hpp"
+
+namespace sat {
+    class Solver;
+
+    /**
+     * @brief Branching heuristics of the portfolio
+     * @details
+     * - Activity: conflict driven variable activities (VSIDS, the solver default)
+     * - FirstVariable: see sat::FirstVariable
+     * - RandomVariable: see sat::RandomVariable
+     */
+    PENUM(Branching, Activity, FirstVariable, RandomVariable)
+
+    /**
+     * @brief Configuration of a single portfolio member
+     */
+    struct SolverConfig {
+        unsigned seed = 0; ///< seed of the random number generator of the worker thread
+        Branching branching = Branching::Activity; ///< variable selection heuristic
+        RestartPolicy restarts = RestartPolicy::Glucose; ///< restart policy
+        Polarity polarity = Polarity::Positive; ///< initial phases of all variables
+        bool targetPhases = true; ///< whether target phases are used (see Phases::useTarget)
+
+        /**
+         * Configures a solver accordingly. Must be called before solving
+         * @param solver the solver to configure
+         */
+        void apply(Solver &solver) const;
+    };
+
+    /**
+     * Creates diversified configurations. The first one corresponds to the default configuration of the solver
+     * @param numWorkers number of configurations
+     * @return numWorkers pairwise different configurations
+     */
+    std::vector<SolverConfig> portfolio_configs(std::size_t numWorkers);
+
+    /**
+     * @brief Outcome of a portfolio run
+     */
+    struct PortfolioResult {
+        bool satisfiable; ///< whether the problem is satisfiable
+        std::vector<TruthValue> model; ///< satisfying assignment of all variables, empty if unsatisfiable
+        std::size_t winner; ///< index of the configuration that found the result first
+        std::size_t conflicts; ///< number of conflicts of the winner
+        std::vector<ExchangeStats> exchange; ///< clause exchange counters of each solver, empty without sharing
+    };
+
+    /**
+     * Solves a problem with one solver per configuration, each in its own thread. The first solver to finish
+     * determines the result, all others are then cancelled cooperatively (see Solver::setStopToken)
+     * @param problem the problem to solve
+     * @param configs configurations of the portfolio members
+     * @param shareClauses whether the solvers exchange short and low-LBD learned clauses (see ClauseExchange)
+     * @param stop optional token that cancels the whole portfolio
+     * @return the result of the fastest solver or std::nullopt if the portfolio was cancelled before any solver
+     * finished
+     * @throws the first exception thrown by any of the solvers if none of them finished
+     */
+    std::optional<PortfolioResult> solve_portfolio(const inout::DimacsProblem &problem,
+                                                   std::span<const SolverConfig> configs,
+                                                   bool shareClauses = true, std::stop_token stop = {});
+}
+
+#endif //PORTFOLIO_HPP
@@ -0,0 +1,493 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "Preprocessor.hpp"
+#include "Subsumption.hpp"
+
+namespace sat {
+
+    namespace {
+        bool satisfiedBy(const std::vector<TruthValue> &model, Literal l) {
+            return static_cast<short>(model[var(l).get()]) == l.sign();
+        }
+    }
+
+    void EliminationStack::push(Literal witness, std::span<const Literal> clause) {
+        mLiterals.push_back(witness);
+        for (Literal l : clause) {
+            if (l != witness) {
+                mLiterals.push_back(l);
+            }
+        }
+
+        mEnds.push_back(mLiterals.size());
+    }
+
+    std::size_t EliminationStack::size() const noexcept {
+        return mEnds.size();
+    }
+
+    void EliminationStack::extend(std::vector<TruthValue> &model) const {
+        for (std::size_t i = mEnds.size(); i-- > 0;) {
+            const std::size_t begin = i == 0 ? 0 : mEnds[i - 1];
+            const auto clause = std::span(mLiterals).subspan(begin, mEnds[i] - begin);
+            if (std::ranges::none_of(clause, [&model](Literal l) { return satisfiedBy(model, l); })) {
+                const Literal witness = clause.front();
+                model[var(witness).get()] = witness.sign() > 0 ? TruthValue::True : TruthValue::False;
+            }
+        }
+    }
+
+    Preprocessor::Preprocessor(const inout::DimacsProblem &problem) :
+        mNumVariables(problem.numVariables), mOccurrences(2 * problem.numVariables),
+        mNumOccurrences(2 * problem.numVariables, 0), mValues(problem.numVariables, TruthValue::Undefined),
+        mEliminated(problem.numVariables, false), mMarks(2 * problem.numVariables, 0),
+        mCandidates(problem.numVariables) {
+        mClauses.reserve(problem.numClauses());
+        mRemoved.reserve(problem.numClauses());
+        for (auto literals : problem.clauses()) {
+            std::vector<Literal> clause(literals.begin(), literals.end());
+            std::ranges::sort(clause, {}, [](Literal l) { return l.get(); });
+            auto [first, last] = std::ranges::unique(clause);
+            clause.erase(first, last);
+            const auto tautology = std::ranges::adjacent_find(clause, [](Literal a, Literal b) {
+                return a == b.negate();
+            });
+
+            if (tautology == clause.end()) {
+                addClause(std::move(clause));
+            }
+        }
+
+        propagate();
+    }
+
+    bool Preprocessor::isAssigned(Variable x) const {
+        return mValues[x.get()] != TruthValue::Undefined;
+    }
+
+    bool Preprocessor::assign(Literal l) {
+        if (isAssigned(var(l))) {
+            return satisfiedBy(mValues, l);
+        }
+
+        mValues[var(l).get()] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+        mUnits.push_back(l);
+        return true;
+    }
+
+    void Preprocessor::addClause(std::vector<Literal> clause) {
+        if (clause.empty()) {
+            mOk = false;
+            return;
+        }
+
+        if (clause.size() == 1) {
+            mOk = assign(clause.front()) && mOk;
+            return;
+        }
+
+        const auto index = static_cast<std::uint32_t>(mClauses.size());
+        for (Literal l : clause) {
+            mOccurrences[l.get()].push_back(index);
+            ++mNumOccurrences[l.get()];
+            touch(var(l));
+        }
+
+        mClauses.push_back(std::move(clause));
+        mRemoved.push_back(false);
+        ++mNumLiveClauses;
+    }
+
+    void Preprocessor::removeClause(std::uint32_t index) {
+        mRemoved[index] = true;
+        --mNumLiveClauses;
+        for (Literal l : mClauses[index]) {
+            --mNumOccurrences[l.get()];
+            touch(var(l));
+        }
+
+        std::vector<Literal>().swap(mClauses[index]);
+    }
+
+    bool Preprocessor::propagate() {
+        while (mOk && mUnitHead < mUnits.size()) {
+            const Literal l = mUnits[mUnitHead++];
+            for (std::uint32_t index : mOccurrences[l.get()]) {
+                if (!mRemoved[index]) {
+                    removeClause(index);
+                }
+            }
+
+            mOccurrences[l.get()].clear();
+            const Literal falsified = l.negate();
+            const auto strengthened = std::move(mOccurrences[falsified.get()]);
+            mOccurrences[falsified.get()].clear();
+            for (std::uint32_t index : strengthened) {
+                if (mRemoved[index]) {
+                    continue;
+                }
+
+                auto &clause = mClauses[index];
+                std::erase(clause, falsified);
+                --mNumOccurrences[falsified.get()];
+                if (clause.size() > 1) {
+                    for (Literal other : clause) {
+                        touch(var(other));
+                    }
+
+                    continue;
+                }
+
+                // Clauses are stored with at least two literals, so the clause just became a unit
+                if (!assign(clause.front())) {
+                    mOk = false;
+                    break;
+                }
+
+                removeClause(index);
+            }
+        }
+
+        return mOk;
+    }
+
+    const std::vector<std::uint32_t> &Preprocessor::occurrences(Literal l) {
+        auto &list = mOccurrences[l.get()];
+        std::erase_if(list, [this](std::uint32_t index) { return mRemoved[index]; });
+        return list;
+    }
+
+    void Preprocessor::touch(Variable x) {
+        if (isAssigned(x) || mEliminated[x.get()]) {
+            return;
+        }
+
+        const auto cost = static_cast<std::int64_t>(mNumOccurrences[pos(x).get()] * mNumOccurrences[neg(x).get()]);
+        mCandidates.update(x.get(), -cost);
+        mCandidates.push(x.get());
+    }
+
+    bool Preprocessor::resolve(const std::vector<Literal> &positive, const std::vector<Literal> &negative, Variable x,
+                               std::vector<Literal> &resolvent) {
+        ++mStamp;
+        mSteps += positive.size() + negative.size();
+        resolvent.clear();
+        for (Literal l : positive) {
+            if (var(l) != x) {
+                mMarks[l.get()] = mStamp;
+                resolvent.push_back(l);
+            }
+        }
+
+        for (Literal l : negative) {
+            if (var(l) == x || mMarks[l.get()] == mStamp) {
+                continue;
+            }
+
+            if (mMarks[l.negate().get()] == mStamp) {
+                return false;
+            }
+
+            resolvent.push_back(l);
+        }
+
+        return true;
+    }
+
+    bool Preprocessor::eliminate(Variable x) {
+        if (isAssigned(x) || mEliminated[x.get()]) {
+            return false;
+        }
+
+        const std::vector<std::uint32_t> positive = occurrences(pos(x));
+        const std::vector<std::uint32_t> negative = occurrences(neg(x));
+        if ((positive.empty() && negative.empty()) || std::min(positive.size(), negative.size()) > MaxOccurrences) {
+            return false;
+        }
+
+        // The elimination is rejected as soon as the resolvents outnumber the clauses they replace
+        const std::size_t limit = positive.size() + negative.size();
+        std::size_t numResolvents = 0;
+        for (std::uint32_t p : positive) {
+            for (std::uint32_t n : negative) {
+                if (mResolvents.size() == numResolvents) {
+                    mResolvents.emplace_back();
+                }
+
+                auto &resolvent = mResolvents[numResolvents];
+                if (!resolve(mClauses[p], mClauses[n], x, resolvent)) {
+                    continue;
+                }
+
+                if (resolvent.size() > MaxResolventSize || ++numResolvents > limit) {
+                    return false;
+                }
+            }
+        }
+
+        // Marked first, so that removing its clauses does not queue x again
+        mEliminated[x.get()] = true;
+        ++mNumEliminated;
+        for (std::uint32_t p : positive) {
+            mStack.push(pos(x), mClauses[p]);
+            removeClause(p);
+        }
+
+        for (std::uint32_t n : negative) {
+            mStack.push(neg(x), mClauses[n]);
+            removeClause(n);
+        }
+
+        for (std::size_t i = 0; i < numResolvents; ++i) {
+            addClause(mResolvents[i]);
+        }
+
+        propagate();
+        return true;
+    }
+
+    bool Preprocessor::subsume() {
+        if (!mOk) {
+            return false;
+        }
+
+        Subsumption subsumption(mNumVariables);
+        std::vector<std::uint32_t> indices;
+        for (std::uint32_t i = 0; i < mClauses.size(); ++i) {
+            if (!mRemoved[i]) {
+                subsumption.add(mClauses[i]);
+                indices.push_back(i);
+            }
+        }
+
+        subsumption.run();
+        mNumSubsumed += subsumption.numSubsumed();
+        mNumStrengthened += subsumption.numStrengthened();
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            if (subsumption.subsumed(i)) {
+                removeClause(indices[i]);
+            } else if (subsumption.strengthenedBy(i) != Subsumption::None) {
+                // Replaced by the strengthened copy. Units are propagated below
+                removeClause(indices[i]);
+                const auto literals = subsumption.clause(i);
+                addClause(std::vector(literals.begin(), literals.end()));
+            }
+        }
+
+        return propagate();
+    }
+
+    bool Preprocessor::substituteEquivalences() {
+        if (!mOk) {
+            return false;
+        }
+
+        // Implication edges of the binary clauses: (a or b) yields ¬a -> b and ¬b -> a
+        const std::size_t numLiterals = 2 * mNumVariables;
+        std::vector<std::vector<Literal>> implications(numLiterals);
+        for (std::size_t i = 0; i < mClauses.size(); ++i) {
+            if (!mRemoved[i] && mClauses[i].size() == 2) {
+                const auto &clause = mClauses[i];
+                implications[clause[0].negate().get()].push_back(clause[1]);
+                implications[clause[1].negate().get()].push_back(clause[0]);
+            }
+        }
+
+        // Tarjan's algorithm with an explicit DFS stack of (literal, next edge)
+        constexpr auto Unvisited = std::numeric_limits<std::uint32_t>::max();
+        std::vector<std::uint32_t> order(numLiterals, Unvisited);
+        std::vector<std::uint32_t> lowLink(numLiterals, 0);
+        std::vector<bool> onStack(numLiterals, false);
+        std::vector<Literal> component;
+        std::vector<std::pair<Literal, std::uint32_t>> path;
+        std::vector<Literal> representative;
+        representative.reserve(numLiterals);
+        for (unsigned l = 0; l < numLiterals; ++l) {
+            representative.emplace_back(l);
+        }
+
+        std::uint32_t counter = 0;
+        auto visit = [&](Literal l) {
+            order[l.get()] = lowLink[l.get()] = counter++;
+            component.push_back(l);
+            onStack[l.get()] = true;
+            path.emplace_back(l, 0);
+        };
+
+        for (unsigned root = 0; root < numLiterals && mOk; ++root) {
+            if (order[root] != Unvisited || implications[root].empty()) {
+                continue;
+            }
+
+            visit(root);
+            while (!path.empty() && mOk) {
+                const auto [l, next] = path.back();
+                if (next < implications[l.get()].size()) {
+                    ++path.back().second;
+                    const Literal implied = implications[l.get()][next];
+                    if (order[implied.get()] == Unvisited) {
+                        visit(implied);
+                    } else if (onStack[implied.get()]) {
+                        lowLink[l.get()] = std::min(lowLink[l.get()], order[implied.get()]);
+                    }
+
+                    continue;
+                }
+
+                path.pop_back();
+                if (!path.empty()) {
+                    const Literal parent = path.back().first;
+                    lowLink[parent.get()] = std::min(lowLink[parent.get()], lowLink[l.get()]);
+                }
+
+                if (lowLink[l.get()] != order[l.get()]) {
+                    continue;
+                }
+
+                // l is the root of a strongly connected component, i.e. all literals of the component are equivalent.
+                // The negated component is represented by the negated representative
+                const auto begin = std::ranges::find(component, l);
+                const Literal min = *std::min_element(begin, component.end(), [](Literal a, Literal b) {
+                    return var(a).get() < var(b).get();
+                });
+
+                ++mStamp;
+                for (auto it = begin; it != component.end(); ++it) {
+                    onStack[it->get()] = false;
+                    representative[it->get()] = min;
+                    mMarks[it->get()] = mStamp;
+                    if (mMarks[it->negate().get()] == mStamp) {
+                        mOk = false;
+                    }
+                }
+
+                component.erase(begin, component.end());
+            }
+        }
+
+        if (!mOk) {
+            return false;
+        }
+
+        // Each substituted variable x with representative r is recorded by the clauses (x or ¬r) and (¬x or r), so
+        // extend() assigns x the value of r
+        std::vector<std::uint32_t> affected;
+        for (unsigned x = 0; x < mNumVariables; ++x) {
+            const Literal r = representative[pos(Variable(x)).get()];
+            if (var(r) == Variable(x)) {
+                continue;
+            }
+
+            mStack.push(pos(Variable(x)), std::array{pos(Variable(x)), r.negate()});
+            mStack.push(neg(Variable(x)), std::array{neg(Variable(x)), r});
+            mEliminated[x] = true;
+            ++mNumSubstituted;
+            for (Literal l : {pos(Variable(x)), neg(Variable(x))}) {
+                const auto &indices = occurrences(l);
+                affected.insert(affected.end(), indices.begin(), indices.end());
+            }
+        }
+
+        std::vector<Literal> substituted;
+        for (std::uint32_t index : affected) {
+            // Clauses containing several substituted variables are replaced on their first visit
+            if (mRemoved[index]) {
+                continue;
+            }
+
+            ++mStamp;
+            substituted.clear();
+            bool tautology = false;
+            for (Literal l : mClauses[index]) {
+                const Literal r = representative[l.get()];
+                tautology = tautology || mMarks[r.negate().get()] == mStamp;
+                if (mMarks[r.get()] != mStamp) {
+                    mMarks[r.get()] = mStamp;
+                    substituted.push_back(r);
+                }
+            }
+
+            removeClause(index);
+            if (!tautology) {
+                addClause(substituted);
+            }
+        }
+
+        return propagate();
+    }
+
+    bool Preprocessor::eliminateVariables() {
+        for (unsigned x = 0; x < mNumVariables; ++x) {
+            touch(Variable(x));
+        }
+
+        while (mOk && !mCandidates.empty() && mSteps < StepLimit) {
+            eliminate(Variable(mCandidates.pop()));
+        }
+
+        return mOk;
+    }
+
+    bool Preprocessor::ok() const noexcept {
+        return mOk;
+    }
+
+    inout::DimacsProblem Preprocessor::problem() const {
+        inout::DimacsProblem simplified;
+        simplified.header(mNumVariables, mUnits.size() + mNumLiveClauses);
+        for (Literal l : mUnits) {
+            simplified.literal(l);
+            simplified.endClause();
+        }
+
+        for (std::size_t i = 0; i < mClauses.size(); ++i) {
+            if (mRemoved[i]) {
+                continue;
+            }
+
+            for (Literal l : mClauses[i]) {
+                simplified.literal(l);
+            }
+
+            simplified.endClause();
+        }
+
+        return simplified;
+    }
+
+    void Preprocessor::extend(std::vector<TruthValue> &model) const {
+        for (Literal l : mUnits) {
+            model[var(l).get()] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+        }
+
+        mStack.extend(model);
+    }
+
+    std::size_t Preprocessor::numEliminated() const noexcept {
+        return mNumEliminated;
+    }
+
+    std::size_t Preprocessor::numSubstituted() const noexcept {
+        return mNumSubstituted;
+    }
+
+    std::size_t Preprocessor::numSubsumed() const noexcept {
+        return mNumSubsumed;
+    }
+
+    std::size_t Preprocessor::numStrengthened() const noexcept {
+        return mNumStrengthened;
+    }
+
+    std::size_t Preprocessor::numClauses() const noexcept {
+        return mNumLiveClauses;
+    }
+}
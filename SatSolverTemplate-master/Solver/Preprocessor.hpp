@@ -0,0 +1,212 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file Preprocessor.hpp
+* @brief Contains the simplification of problems before search and the reconstruction of models of the original problem
+*/
+
+#ifndef PREPROCESSOR_HPP
+#define PREPROCESSOR_HPP
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+#include "basic_structures.hpp"
+#include "inout.hpp"
+#include "util/IndexedHeap.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Clauses removed from a formula together with the literals that repair them (witnesses)
+     * @details A model of the simplified formula is turned into a model of the original formula by visiting the removed
+     * clauses in reverse order and setting the witness of each falsified clause to true. This is sound as long as every
+     * clause is pushed before any clause that might be falsified by flipping its witness, which holds for variable
+     * elimination since the clauses of an eliminated variable never contain variables that are eliminated before.
+     */
+    class EliminationStack {
+        std::vector<Literal> mLiterals;
+        std::vector<std::size_t> mEnds;
+    public:
+        /**
+         * Records a removed clause
+         * @param witness literal of the clause that is set to true if the clause is falsified
+         * @param clause the removed clause, must contain the witness
+         */
+        void push(Literal witness, std::span<const Literal> clause);
+
+        /**
+         * Number of recorded clauses
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * Extends a model of the simplified formula to a model of the original formula
+         * @param model assignment of all variables, values of eliminated variables are overwritten
+         */
+        void extend(std::vector<TruthValue> &model) const;
+    };
+
+    /**
+     * @brief Simplifies a problem before search
+     * @details Clauses are kept in occurrence lists, so all clauses of a literal can be visited. Unit clauses are
+     * propagated eagerly. subsume() removes subsumed clauses and strengthens clauses using Subsumption.
+     * substituteEquivalences() replaces equivalent literals, i.e. literals of a strongly connected component of the
+     * binary implication graph, by a single representative. Bounded
+     * variable elimination replaces all clauses of a variable x by the non-tautological resolvents of the clauses
+     * containing x with the clauses containing ¬x, as long as there are no more resolvents than removed clauses.
+     * Candidates are visited cheapest first (smallest product of positive and negative occurrences) using a priority
+     * queue that is updated whenever the occurrences of a variable change.
+     * The simplified problem has the same variables, eliminated and substituted variables just do not occur anymore.
+     * Models of the simplified problem are extended to these variables using extend().
+     */
+    class Preprocessor {
+        std::size_t mNumVariables;
+        std::vector<std::vector<Literal>> mClauses;
+        std::vector<bool> mRemoved;
+        std::vector<std::vector<std::uint32_t>> mOccurrences; // Clause indices per literal, may contain removed clauses
+        std::vector<std::size_t> mNumOccurrences;             // Number of live clauses per literal
+        std::vector<TruthValue> mValues;                       // Assignment implied by unit clauses
+        std::vector<Literal> mUnits;                           // Assigned literals in assignment order
+        std::size_t mUnitHead = 0;                             // Next unit to propagate
+        std::vector<bool> mEliminated;                         // Eliminated or substituted variables
+        std::vector<std::uint64_t> mMarks;                     // Per literal marks used to detect tautologies
+        std::uint64_t mStamp = 0;
+        IndexedMaxHeap<std::int64_t> mCandidates;              // Variables keyed by the negated elimination cost
+        EliminationStack mStack;
+        std::vector<std::vector<Literal>> mResolvents;         // Scratch buffer of eliminate()
+        std::size_t mSteps = 0;                                // Literals visited during resolution so far
+        std::size_t mNumLiveClauses = 0;
+        std::size_t mNumEliminated = 0;
+        std::size_t mNumSubstituted = 0;
+        std::size_t mNumSubsumed = 0;
+        std::size_t mNumStrengthened = 0;
+        bool mOk = true;
+
+        static constexpr std::size_t MaxOccurrences = 16;     // Variables with more occurrences of both signs are kept
+        static constexpr std::size_t MaxResolventSize = 20;   // Variables producing longer resolvents are kept
+        static constexpr std::size_t StepLimit = 100'000'000; // Elimination stops after visiting this many literals
+
+        bool isAssigned(Variable x) const;
+
+        /**
+         * Assigns a literal implied by a unit clause
+         * @return false if the literal is already falsified
+         */
+        bool assign(Literal l);
+
+        /**
+         * Stores a clause that contains only unassigned literals, units are assigned instead
+         */
+        void addClause(std::vector<Literal> clause);
+
+        /**
+         * Removes a clause and updates the occurrence counts of its literals
+         */
+        void removeClause(std::uint32_t index);
+
+        /**
+         * Propagates all pending units: satisfied clauses are removed, falsified literals are removed from clauses
+         * @return false if a clause becomes empty
+         */
+        bool propagate();
+
+        /**
+         * Live clauses of a literal. Removed clauses are dropped from the occurrence list on the way
+         */
+        const std::vector<std::uint32_t> &occurrences(Literal l);
+
+        /**
+         * Updates the elimination cost of a variable after its occurrences changed and queues it again
+         */
+        void touch(Variable x);
+
+        /**
+         * Computes the resolvent of two clauses on the given variable
+         * @param positive clause containing pos(x)
+         * @param negative clause containing neg(x)
+         * @param resolvent output: the resolvent
+         * @return false if the resolvent is a tautology
+         */
+        bool resolve(const std::vector<Literal> &positive, const std::vector<Literal> &negative, Variable x,
+                     std::vector<Literal> &resolvent);
+
+        /**
+         * Eliminates a variable if this does not increase the number of clauses
+         * @return true if the variable was eliminated
+         */
+        bool eliminate(Variable x);
+
+    public:
+        /**
+         * Ctor. Loads the clauses of a problem and propagates its unit clauses
+         * @param problem the problem to simplify
+         */
+        explicit Preprocessor(const inout::DimacsProblem &problem);
+
+        /**
+         * Removes subsumed clauses and strengthens clauses by self-subsuming resolution (see Subsumption)
+         * @return false if the problem was found to be unsatisfiable
+         */
+        bool subsume();
+
+        /**
+         * Detects equivalent literals as strongly connected components of the binary implication graph (using an
+         * iterative version of Tarjan's algorithm) and replaces each component by its literal with the smallest
+         * variable in all clauses. Substituted variables are assigned by extend()
+         * @return false if the problem was found to be unsatisfiable, i.e. a literal is equivalent to its negation
+         */
+        bool substituteEquivalences();
+
+        /**
+         * Runs bounded variable elimination until no variable can be eliminated anymore
+         * @return false if the problem was found to be unsatisfiable
+         */
+        bool eliminateVariables();
+
+        /**
+         * Whether the problem may be satisfiable, i.e. no empty clause was derived
+         */
+        bool ok() const noexcept;
+
+        /**
+         * The simplified problem over the same variables. Unit clauses found during preprocessing are included
+         */
+        inout::DimacsProblem problem() const;
+
+        /**
+         * Extends a model of the simplified problem to a model of the original problem
+         * @param model assignment of all variables, values of eliminated variables are overwritten
+         */
+        void extend(std::vector<TruthValue> &model) const;
+
+        /**
+         * Number of eliminated variables
+         */
+        std::size_t numEliminated() const noexcept;
+
+        /**
+         * Number of variables replaced by equivalent literals
+         */
+        std::size_t numSubstituted() const noexcept;
+
+        /**
+         * Number of clauses removed by subsume()
+         */
+        std::size_t numSubsumed() const noexcept;
+
+        /**
+         * Number of clauses strengthened by subsume()
+         */
+        std::size_t numStrengthened() const noexcept;
+
+        /**
+         * Number of clauses of the simplified problem, not counting unit clauses
+         */
+        std::size_t numClauses() const noexcept;
+    };
+}
+
+#endif //PREPROCESSOR_HPP
@@ -1,45 +1,93 @@
 #include "Solver.hpp"
+#include "Subsumption.hpp"
 #include "util/exception.hpp"
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <optional>
+#include <set>
 
 namespace sat {
 
     Solver::Solver(unsigned numVariables)
         : mModel(numVariables, TruthValue::Undefined),
-        mHeuristic(FirstVariable())
+        mLevel(numVariables, 0),
+        mReason(numVariables, NoClause),
+        mSeen(numVariables, 0),
+        mActivity(numVariables),
+        mPhases(numVariables),
+        mLevelStamp(numVariables + 1, 0)
     {
         // 2 * numVariables possible literal IDs (positive & negative).
         mWatchers.resize(numVariables * 2);
+        mBinaryWatchers.resize(numVariables * 2);
+        mTrail.reserve(numVariables);
     }
 
     bool Solver::addClause(Clause clause)
     {
+        return addClause(std::span<const Literal>(clause.begin(), clause.end()));
+    }
+
+    bool Solver::addClause(std::span<const Literal> literals) {
+        // New clauses are only added at the top level
+        unassignBack(0);
+        const std::uint64_t id = mNextId++;
+
         // Empty clause => immediate conflict
-        if (clause.isEmpty()) {
+        if (literals.empty()) {
+            mOk = false;
+            logEmptyClause({}, id);
+            return false;
+        }
+
+        // Normalize: remove duplicate literals and drop tautologies (x or not x)
+        auto &lits = mClauseBuffer;
+        lits.assign(literals.begin(), literals.end());
+        std::ranges::sort(lits, {}, [](Literal l) { return l.get(); });
+        auto [first, last] = std::ranges::unique(lits);
+        lits.erase(first, last);
+        for (std::size_t i = 1; i < lits.size(); ++i) {
+            if (lits[i] == lits[i - 1].negate()) {
+                return true;
+            }
+        }
+
+        // Literals that are not falsified yet go to the front so that they become the watchers
+        std::ranges::partition(lits, [this](Literal l) { return !falsified(l); });
+        if (falsified(lits[0])) {
+            mOk = false;
+            logEmptyClause(lits, id);
             return false;
         }
-        // Wrap the clause in a shared_ptr
-        auto cp = std::make_shared<Clause>(std::move(clause));
-        mClauses.push_back(cp);
+
+        // Store the clause in the arena
+        ClauseRef cref = mArena.alloc(lits, false);
+        mArena[cref].setId(id);
+        mClauses.push_back(cref);
 
         // If it's a unit clause => assign right away
-        if (cp->size() == 1) {
-            Literal theOnlyLit = (*cp)[0];
-            if (!assign(theOnlyLit)) {
-                // Conflict if it’s already falsified
-                return false;
+        if (lits.size() == 1) {
+            assign(lits[0], NoClause);
+            if (!mUnitIds.empty() && mUnitIds[var(lits[0]).get()] == 0) {
+                mUnitIds[var(lits[0]).get()] = id;
             }
-            // Watch the single literal anyway
-            mWatchers[indexOf(theOnlyLit)].push_back(cp);
+
+            return true;
         }
-        else {
-            // Otherwise watch its two watchers
-            Literal w0 = cp->getWatcherByRank(0);
-            Literal w1 = cp->getWatcherByRank(1);
-            mWatchers[indexOf(w0)].push_back(cp);
-            mWatchers[indexOf(w1)].push_back(cp);
+
+        // Otherwise watch its first two literals
+        if (mBulkAdd) {
+            mPendingAttach.push_back(cref);
+        } else {
+            attachClause(cref);
+        }
+
+        // The clause may already be unit under the current assignment
+        if (falsified(lits[1])) {
+            return assign(lits[0], cref);
         }
+
         return true;
     }
 
@@ -48,14 +96,14 @@ namespace sat {
      *   - Skip clauses that are already satisfied
      *   - In remaining clauses, remove all falsified literals
      */
-        
+
     std::vector<Clause> Solver::rebase() const {
         std::vector<Clause> rebased;
-        
+
         // First, collect assigned variables
         std::vector<bool> isAssigned(mModel.size(), false);
-        for (const auto& clausePtr : mClauses) {
-            const Clause& clause = *clausePtr;
+        for (ClauseRef cref : mClauses) {
+            const ArenaClause& clause = mArena[cref];
             for (const Literal& lit : clause) {
                 Variable v = var(lit);
                 if (val(v) != TruthValue::Undefined) {
@@ -63,22 +111,24 @@ namespace sat {
                 }
             }
         }
-        
+
         // Add unit clauses for assigned variables
         for (unsigned varId = 0; varId < mModel.size(); ++varId) {
             if (isAssigned[varId] && mModel[varId] != TruthValue::Undefined) {
-                Literal l = (mModel[varId] == TruthValue::True) ? 
+                Literal l = (mModel[varId] == TruthValue::True) ?
                         pos(Variable(varId)) : neg(Variable(varId));
                 rebased.push_back(Clause({l}));
             }
         }
-        
-        // Add remaining non-satisfied clauses with non-falsified literals
-        for (const auto& clausePtr : mClauses) {
-            const Clause& clause = *clausePtr;
+
+        // Add remaining non-satisfied clauses with non-falsified literals. Duplicates are detected on the sorted
+        // literal ids
+        std::set<std::vector<unsigned>> added;
+        for (ClauseRef cref : mClauses) {
+            const ArenaClause& clause = mArena[cref];
             std::vector<Literal> newLits;
             bool isClauseSatisfied = false;
-            
+
             for (const Literal& lit : clause) {
                 if (satisfied(lit)) {
                     isClauseSatisfied = true;
@@ -88,239 +138,1427 @@ namespace sat {
                     newLits.push_back(lit);
                 }
             }
-            
+
             if (!isClauseSatisfied && !newLits.empty()) {
-                bool isDuplicate = false;
-                for (const auto& existing : rebased) {
-                    if (existing.sameLiterals({newLits})) {
-                        isDuplicate = true;
-                        break;
-                    }
-                }
-                if (!isDuplicate) {
+                std::vector<unsigned> key;
+                std::ranges::transform(newLits, std::back_inserter(key), [](Literal l) { return l.get(); });
+                std::ranges::sort(key);
+                if (added.insert(std::move(key)).second) {
                     rebased.push_back(Clause(std::move(newLits)));
                 }
             }
         }
-        
+
         return rebased;
     }
-    
+
     TruthValue Solver::val(Variable x) const {
         return mModel[x.get()];
     }
 
     bool Solver::satisfied(Literal l) const {
-        TruthValue tv = val(var(l));
-        if (tv == TruthValue::Undefined) {
-            return false;
-        }
-        // Positive lit is satisfied if variable==True; negative if variable==False
-        return ( (l.sign() > 0 && tv == TruthValue::True)
-              || (l.sign() < 0 && tv == TruthValue::False));
+        // TruthValue::True == 1 and TruthValue::False == -1 => a literal is satisfied iff the value equals its sign
+        return static_cast<short>(val(var(l))) == l.sign();
     }
 
     bool Solver::falsified(Literal l) const {
         // A literal l is falsified if its negation is satisfied
-        TruthValue tv = val(var(l));
-        if (tv == TruthValue::Undefined) {
-            return false;
-        }
-        // Positive lit is falsified if variable==False; negative if variable==True
-        return ( (l.sign() > 0 && tv == TruthValue::False)
-              || (l.sign() < 0 && tv == TruthValue::True));
+        return static_cast<short>(val(var(l))) == -l.sign();
     }
 
     bool Solver::assign(Literal l) {
+        return assign(l, NoClause);
+    }
+
+    bool Solver::assign(Literal l, ClauseRef reason) {
         Variable v = var(l);
-        
+
         // Check current assignment
         if (val(v) != TruthValue::Undefined) {
             // Already assigned
-            return (val(v) == TruthValue::True && l.sign() > 0) || 
-                   val(v) == TruthValue::False && l.sign() < 0;
+            return satisfied(l);
         }
-        
+
         // Make new assignment
         mModel[v.get()] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
-        mUnitQueue.push_back(l);
-        
+        mLevel[v.get()] = decisionLevel();
+        mReason[v.get()] = reason;
+        mTrail.push_back(l);
+
+        // The XOR engine sees every assignment right away. Its implications are assigned by propagateXors()
+        if (mGaussJordan && mXorConflict.empty()) {
+            if (!mGaussJordan->assign(v, mModel)) {
+                const auto conflict = mGaussJordan->conflict();
+                mXorConflict.assign(conflict.begin(), conflict.end());
+            }
+
+            for (std::size_t i = 0; i < mGaussJordan->numImplied(); ++i) {
+                const auto explanation = mGaussJordan->implied(i);
+                mXorImplied.insert(mXorImplied.end(), explanation.begin(), explanation.end());
+                mXorImpliedEnds.push_back(mXorImplied.size());
+            }
+        }
+
         return true;
     }
 
-    bool Solver::unitPropagate()
-{
-    // Process newly assigned literals until no more changes
-    while (!mUnitQueue.empty()) {
-        Literal assignedLit = mUnitQueue.front();
-        mUnitQueue.pop_front();
+    unsigned Solver::decisionLevel() const {
+        return static_cast<unsigned>(mTrailLim.size());
+    }
+
+    bool Solver::unitPropagate() {
+        endBulkAdd();
+        return mOk && propagate() == NoClause;
+    }
 
-        // We only need to handle watchers of the *negation* of assignedLit
-        Literal notLit = assignedLit.negate();
-        auto &oldWatchList = mWatchers[indexOf(notLit)];
+    void Solver::attachClause(ClauseRef cref) {
+        const ArenaClause &clause = mArena[cref];
+        assert(clause.size() >= 2);
+        if (clause.size() == 2) {
+            mBinaryWatchers[indexOf(clause[0])].push_back({clause[1], cref});
+            mBinaryWatchers[indexOf(clause[1])].push_back({clause[0], cref});
+        } else {
+            mWatchers[indexOf(clause[0])].push_back({cref, clause[1]});
+            mWatchers[indexOf(clause[1])].push_back({cref, clause[0]});
+        }
+    }
 
-        // We'll build a fresh watch list for notLit as we iterate
-        std::vector<ClausePointer> newWatchList;
-        newWatchList.reserve(oldWatchList.size());
+    ClauseRef Solver::propagate() {
+        // Process newly assigned literals until no more changes
+        while (true) {
+            // Binary clauses first: follow the implication edges of all pending literals without touching the arena
+            while (mBinaryQueueHead < mTrail.size()) {
+                Literal notLit = mTrail[mBinaryQueueHead++].negate();
+                for (const auto &[implied, clause] : mBinaryWatchers[indexOf(notLit)]) {
+                    if (!assign(implied, clause)) {
+                        mQueueHead = mBinaryQueueHead = mTrail.size();
+                        return clause;
+                    }
+                }
+            }
 
-        for (auto &cl : oldWatchList) {
-            // Which rank is notLit?
-            short rank = cl->getRank(notLit);
-            short otherRank = rank ^ 1;  // flip 0<->1
-            Literal otherWatch = cl->getWatcherByRank(otherRank);
+            // XOR implications before longer clauses, since they are found in the order of the assignments
+            if (!mXorImpliedEnds.empty() || !mXorConflict.empty()) {
+                if (ClauseRef conflict = propagateXors(); conflict != NoClause) {
+                    mQueueHead = mBinaryQueueHead = mTrail.size();
+                    return conflict;
+                }
 
-            // If other watcher is satisfied, do nothing
-            if (satisfied(otherWatch)) {
-                newWatchList.push_back(cl);
                 continue;
             }
 
-            // Attempt ring search for a replacement literal
-            std::size_t startIdx = cl->getIndex(rank);
-            bool replaced = false;
+            if (mQueueHead == mTrail.size()) {
+                break;
+            }
+
+            Literal assignedLit = mTrail[mQueueHead++];
+
+            // We only need to handle watchers of the *negation* of assignedLit
+            Literal notLit = assignedLit.negate();
+            auto &watchList = mWatchers[indexOf(notLit)];
+
+            // The watch list is compacted in place: entries [0, keep) are the ones that still watch notLit,
+            // entries [next, size) have not been visited yet
+            std::size_t keep = 0;
+            std::size_t next = 0;
+            const std::size_t numWatchers = watchList.size();
+            while (next < numWatchers) {
+                const Watcher watcher = watchList[next++];
 
-            for (std::size_t i = 0, sz = cl->size(); i < sz; i++) {
-                // Next index in ring fashion
-                std::size_t idx = (startIdx + 1 + i) % sz;
-                // Skip the other watch
-                if (idx == cl->getIndex(otherRank)) {
+                // Satisfied blocker => clause is satisfied, no need to look at the clause
+                if (satisfied(watcher.blocker)) {
+                    watchList[keep++] = watcher;
                     continue;
                 }
-                Literal candidate = (*cl)[idx];
 
-                if (!falsified(candidate)) {
-                    // Switch watch from notLit -> candidate
-                    cl->setWatcher(candidate, rank);
-                    // Put the clause in watchers of candidate
-                    mWatchers[indexOf(candidate)].push_back(cl);
-                    replaced = true;
-                    break;
+                // The watchers are the first two literals. Make sure notLit is the second one
+                ArenaClause &cl = mArena[watcher.clause];
+                if (cl[0] == notLit) {
+                    std::swap(cl[0], cl[1]);
                 }
-            }
 
-            if (!replaced) {
-                // No replacement found => otherWatch must be unit
-                if (falsified(otherWatch)) {
-                    return false; // Conflict
+                // If other watcher is satisfied, do nothing but remember it as the new blocker
+                Literal otherWatch = cl[0];
+                if (otherWatch != watcher.blocker && satisfied(otherWatch)) {
+                    watchList[keep++] = {watcher.clause, otherWatch};
+                    continue;
                 }
-                if (val(var(otherWatch)) == TruthValue::Undefined) {
-                    if (!assign(otherWatch)) {
-                        return false; // Conflict
+
+                // Attempt ring search for a replacement literal among the non-watched literals,
+                // starting where the last search stopped
+                const std::size_t sz = cl.size();
+                const std::size_t startIdx = cl.searchPos();
+                bool replaced = false;
+                for (std::size_t i = 0; i < sz - 2; i++) {
+                    std::size_t idx = startIdx + i;
+                    if (idx >= sz) {
+                        idx -= sz - 2;
+                    }
+
+                    Literal candidate = cl[idx];
+                    if (!falsified(candidate)) {
+                        // Switch watch from notLit -> candidate
+                        std::swap(cl[1], cl[idx]);
+                        cl.setSearchPos(static_cast<std::uint32_t>(idx));
+                        // Put the clause in watchers of candidate
+                        mWatchers[indexOf(candidate)].push_back({watcher.clause, otherWatch});
+                        replaced = true;
+                        break;
                     }
                 }
+
+                if (replaced) {
+                    continue;
+                }
+
+                // No replacement found => otherWatch must be unit
                 // We continue to watch notLit
-                newWatchList.push_back(cl);
-            }
-        }
-        // Swap in the updated watch list for notLit
-        oldWatchList.swap(newWatchList);
-    }
-    return true; // No conflict
-}
-
-bool Solver::solve() {
-    // We'll represent three states: UNKNOWN, SAT, UNSAT
-    enum class State { UNKNOWN, SAT, UNSAT };
-    State satisfiability = State::UNKNOWN;
-
-    // Clear any old decisions
-    mTrail.clear();
-    mTrail.reserve(mModel.size());
-    
-    // Reset model to undefined
-    std::fill(mModel.begin(), mModel.end(), TruthValue::Undefined);
-    mUnitQueue.clear();
-
-    // Repeatedly propagate or branch until SAT/UNSAT is determined
-    while (satisfiability == State::UNKNOWN) {
-        // First, propagate forced literals
-        if (!unitPropagate()) {
-            // Conflict -> check if we can backtrack
-            if (mTrail.empty()) {
-                satisfiability = State::UNSAT;
-            } else {
-                //  Backtrack: revert to last decision level
-                std::size_t checkpoint = mTrail.back();
-                mTrail.pop_back();
-                unassignBack(checkpoint);
-                
-                // Try to flip the last decision
-                if (!branchFlip()) {
-                    // If flipping fails and no more decisions, formula is UNSAT
-                    if (mTrail.empty()) {
-                        satisfiability = State::UNSAT;
+                watchList[keep++] = {watcher.clause, otherWatch};
+                if (!assign(otherWatch, watcher.clause)) {
+                    // Conflict: the remaining clauses keep watching notLit
+                    while (next < numWatchers) {
+                        watchList[keep++] = watchList[next++];
                     }
+
+                    watchList.erase(watchList.begin() + static_cast<std::ptrdiff_t>(keep), watchList.end());
+                    mQueueHead = mBinaryQueueHead = mTrail.size();
+                    return watcher.clause;
+                }
+            }
+
+            watchList.erase(watchList.begin() + static_cast<std::ptrdiff_t>(keep), watchList.end());
+        }
+
+        return NoClause; // No conflict
+    }
+
+    unsigned Solver::analyze(ClauseRef conflict, std::vector<Literal> &learnt) {
+        learnt.clear();
+        learnt.push_back(0); // placeholder for the asserting literal
+        // Stamps of previous analyses are smaller, so no marks have to be cleared
+        mSeenStamp += 2;
+        int pathCount = 0;
+        std::size_t index = mTrail.size();
+        std::optional<Literal> implied;
+        do {
+            assert(conflict != NoClause);
+            clauseUsed(conflict);
+            for (Literal q : mArena[conflict]) {
+                if (implied && q == *implied) {
                     continue;
                 }
+
+                const auto v = var(q).get();
+                if (mSeen[v] < mSeenStamp && mLevel[v] > 0) {
+                    mSeen[v] = mSeenStamp;
+                    mActivity.bump(var(q));
+                    if (mLevel[v] == decisionLevel()) {
+                        ++pathCount;
+                    } else {
+                        learnt.push_back(q);
+                    }
+                }
             }
-        } else {
-            // Check if all variables assigned -> SAT
-            if (allVariablesAssigned()) {
-                satisfiability = State::SAT;
+
+            // Walk back to the next marked literal of the conflict level
+            while (mSeen[var(mTrail[--index]).get()] < mSeenStamp) {}
+            implied = mTrail[index];
+            conflict = mReason[var(*implied).get()];
+            mSeen[var(*implied).get()] = 0;
+            --pathCount;
+        } while (pathCount > 0);
+        learnt[0] = implied->negate();
+        minimize(learnt);
+
+        // The literal with the highest level among the remaining ones determines the backjump level
+        unsigned backjumpLevel = 0;
+        if (learnt.size() > 1) {
+            std::size_t maxIdx = 1;
+            for (std::size_t i = 2; i < learnt.size(); ++i) {
+                if (mLevel[var(learnt[i]).get()] > mLevel[var(learnt[maxIdx]).get()]) {
+                    maxIdx = i;
+                }
+            }
+
+            std::swap(learnt[1], learnt[maxIdx]);
+            backjumpLevel = mLevel[var(learnt[1]).get()];
+        }
+
+        return backjumpLevel;
+    }
+
+    void Solver::minimize(std::vector<Literal> &learnt) {
+        std::uint32_t abstractLevels = 0;
+        for (std::size_t i = 1; i < learnt.size(); ++i) {
+            abstractLevels |= abstractLevel(var(learnt[i]));
+        }
+
+        // The asserting literal is never removed
+        const auto oldSize = learnt.size();
+        auto removed = std::remove_if(learnt.begin() + 1, learnt.end(), [this, abstractLevels](Literal l) {
+            return mReason[var(l).get()] != NoClause && isRedundant(l, abstractLevels);
+        });
+        learnt.erase(removed, learnt.end());
+        mMinimizedLiterals += oldSize - learnt.size();
+    }
+
+    bool Solver::isRedundant(Literal l, std::uint32_t abstractLevels) {
+        // Iterative depth first search over the reasons. Each stack entry holds a literal and the position of the next
+        // literal of its reason to visit
+        const std::uint64_t poisoned = mSeenStamp + 1;
+        mMinimizeStack.clear();
+        mMinimizeStack.emplace_back(l, 0);
+        while (!mMinimizeStack.empty()) {
+            auto &[current, next] = mMinimizeStack.back();
+            const ArenaClause &reason = mArena[mReason[var(current).get()]];
+            if (next == reason.size()) {
+                // All literals of the reason are redundant, hence current is redundant too
+                mSeen[var(current).get()] = mSeenStamp;
+                mMinimizeStack.pop_back();
+                continue;
+            }
+
+            const Literal q = reason[next++];
+            const auto v = var(q).get();
+            if (v == var(current).get() || mLevel[v] == 0 || mSeen[v] == mSeenStamp) {
+                continue;
+            }
+
+            if (mSeen[v] == poisoned || mReason[v] == NoClause || !(abstractLevel(var(q)) & abstractLevels)) {
+                // None of the literals on the stack can be redundant. The literal l itself stays in the clause
+                for (auto [visited, _] : std::span(mMinimizeStack).subspan(1)) {
+                    mSeen[var(visited).get()] = poisoned;
+                }
+
+                return false;
+            }
+
+            mMinimizeStack.emplace_back(q, 0);
+        }
+
+        return true;
+    }
+
+    std::uint32_t Solver::abstractLevel(Variable x) const {
+        return 1u << (mLevel[x.get()] & 31);
+    }
+
+    void Solver::analyzeFinal(Literal failed) {
+        mFailedAssumptions.assign(1, failed);
+        if (decisionLevel() == 0) {
+            return;
+        }
+
+        // Walk back over the trail and collect the decisions (which are all assumptions) that imply the negation
+        mSeenStamp += 2;
+        mSeen[var(failed).get()] = mSeenStamp;
+        for (std::size_t i = mTrail.size(); i > mTrailLim.front(); --i) {
+            const Literal l = mTrail[i - 1];
+            const auto v = var(l).get();
+            if (mSeen[v] != mSeenStamp) {
+                continue;
+            }
+
+            if (mReason[v] == NoClause) {
+                mFailedAssumptions.push_back(l);
+                continue;
+            }
+
+            for (Literal q : mArena[mReason[v]]) {
+                if (var(q).get() != v && mLevel[var(q).get()] > 0) {
+                    mSeen[var(q).get()] = mSeenStamp;
+                }
+            }
+        }
+    }
+
+    const std::vector<Literal> &Solver::failedAssumptions() const {
+        return mFailedAssumptions;
+    }
+
+    bool Solver::solve() {
+        return solve({});
+    }
+
+    bool Solver::solve(std::span<const Literal> assumptions) {
+        endBulkAdd();
+        mFailedAssumptions.clear();
+        mInterrupted = false;
+        if (!mOk) {
+            return false;
+        }
+
+        unassignBack(0);
+        if (mExchange != nullptr && !importSharedClauses()) {
+            return false;
+        }
+
+        if (mProbing && !mProbed) {
+            mProbed = true;
+            if (!probe()) {
+                return false;
+            }
+        }
+
+        if (mUseGaussJordan && !mSearchedXors) {
+            mSearchedXors = true;
+            if (!findXors()) {
+                return false;
+            }
+        }
+
+        std::vector<Literal> learnt;
+        while (true) {
+            if (mStop.stop_requested() || mConflicts >= mConflictLimit || memoryUsage() > mMemoryLimit) {
+                mInterrupted = true;
+                unassignBack(0);
+                return false;
+            }
+
+            ClauseRef conflict = propagate();
+            if (conflict != NoClause) {
+                // Conflict without any decision => formula is UNSAT
+                if (decisionLevel() == 0) {
+                    mOk = false;
+                    const ArenaClause &clause = mArena[conflict];
+                    logEmptyClause(std::span(clause.begin(), clause.end()), clause.id());
+                    return false;
+                }
+
+                ++mConflicts;
+                unsigned backjumpLevel = analyze(conflict, learnt);
+                const unsigned lbd = computeLbd(learnt);
+                mActivity.decay();
+                mClauseIncrement /= ClauseDecay;
+                mRestarts.onConflict(lbd, mTrail.size());
+                // Everything below the conflict level is fully propagated and conflict free
+                mPhases.update(std::span(mTrail).first(mTrailLim.back()));
+                if (mProof != nullptr && mProof->lrat()) {
+                    collectHints(conflict, learnt);
+                }
+
+                // Unit clauses required by the hints are derived first, so the id is taken only now
+                const std::uint64_t id = derivedId();
+                if (mProof != nullptr) {
+                    mProof->add(id, learnt, mHints);
+                }
+
+                if (mExchange != nullptr) {
+                    mExchange->offer(learnt, lbd);
+                }
+
+                unassignBack(backjumpLevel);
+                if (learnt.size() == 1) {
+                    assign(learnt[0], NoClause);
+                    if (!mUnitIds.empty()) {
+                        mUnitIds[var(learnt[0]).get()] = id;
+                    }
+                } else {
+                    ClauseRef cref = mArena.alloc(learnt, true);
+                    mArena[cref].setId(id);
+                    mArena[cref].setLbd(lbd);
+                    mArena[cref].setTier(tierOf(lbd));
+                    mArena[cref].setActivity(mClauseIncrement);
+                    mLearnts.push_back(cref);
+                    attachClause(cref);
+                    assign(learnt[0], cref);
+                }
             } else {
-                // Save current decision level
-                mTrail.push_back(mUnitQueue.size());
-                
-                // Make new decision
-                Literal decisionLit = selectLit();
-                if (!assign(decisionLit)) {
-                    mTrail.pop_back();
-                    if (mTrail.empty()) {
-                        satisfiability = State::UNSAT;
+                // Check if all variables assigned -> SAT (pending assumptions are checked below)
+                if (allVariablesAssigned() && decisionLevel() >= assumptions.size()) {
+                    return true;
+                }
+
+                if (mRestarts.shouldRestart()) {
+                    unassignBack(0);
+                    mRestarts.restarted();
+                    mPhases.resetTarget();
+                    if (mExchange != nullptr && !importSharedClauses()) {
+                        return false;
                     }
+
+                    if (mConflicts >= mNextSubsume) {
+                        subsumeLearnts();
+                        mNextSubsume = mConflicts + SubsumeInterval;
+                    }
+
                     continue;
                 }
+
+                if (mPhases.shouldRephase(mConflicts)) {
+                    mPhases.rephase(mConflicts);
+                }
+
+                if (mConflicts >= mNextReduce) {
+                    reduceLearnts();
+                    mNextReduce = mConflicts + FirstReduce + ReduceIncrement * ++mNumReductions;
+                }
+
+                if (mXorReasons.size() > MaxXorReasons) {
+                    dropXorReasons();
+                }
+
+                // Assumptions are decided first, each on its own decision level
+                std::optional<Literal> next;
+                while (!next && decisionLevel() < assumptions.size()) {
+                    const Literal assumption = assumptions[decisionLevel()];
+                    if (falsified(assumption)) {
+                        analyzeFinal(assumption);
+                        unassignBack(0);
+                        return false;
+                    }
+
+                    if (satisfied(assumption)) {
+                        // Empty decision level such that levels and assumptions stay aligned
+                        mTrailLim.push_back(mTrail.size());
+                    } else {
+                        next = assumption;
+                    }
+                }
+
+                if (!next) {
+                    // All assumptions hold, check if all variables assigned -> SAT
+                    if (allVariablesAssigned()) {
+                        return true;
+                    }
+
+                    next = selectLit();
+                }
+
+                // Open a new decision level and make a new decision
+                mTrailLim.push_back(mTrail.size());
+                assign(*next, NoClause);
             }
         }
     }
 
-    return satisfiability == State::SAT;
-}
+    unsigned Solver::computeLbd(std::span<const Literal> literals) {
+        ++mStamp;
+        unsigned lbd = 0;
+        for (Literal l : literals) {
+            auto &stamp = mLevelStamp[mLevel[var(l).get()]];
+            if (stamp != mStamp) {
+                stamp = mStamp;
+                ++lbd;
+            }
+        }
+
+        return lbd;
+    }
 
-// Simple helper that picks a literal from any unassigned variable
-Literal Solver::selectLit() {
-    FirstVariable heuristic;
-    Variable v = heuristic(mModel, mModel.size());
-    // Default to positive literal, but many heuristics are possible
-    return pos(v);
-}
+    ClauseTier Solver::tierOf(unsigned lbd) {
+        if (lbd <= CoreLbd) {
+            return ClauseTier::Core;
+        }
 
-// Helper to revert assignments from the back of mUnitQueue until we reach 'checkpoint'
-void Solver::unassignBack(std::size_t checkpoint) {
-    while (mUnitQueue.size() > checkpoint) {
-        Literal lit = mUnitQueue.back();
-        mUnitQueue.pop_back();
-        mModel[var(lit).get()] = TruthValue::Undefined;
+        return lbd <= Tier2Lbd ? ClauseTier::Tier2 : ClauseTier::Local;
     }
-}
 
-// Helper to flip the last assigned literal (if needed)
-bool Solver::branchFlip() {
-    if (mUnitQueue.empty()) {
-        return false;
+    void Solver::clauseUsed(ClauseRef cref) {
+        ArenaClause &clause = mArena[cref];
+        if (!clause.learnt()) {
+            return;
+        }
+
+        clause.setUsed(true);
+        if (clause.imported()) {
+            clause.setImported(false);
+            mExchange->importedClauseUsed();
+        }
+
+        clause.setActivity(clause.activity() + mClauseIncrement);
+        if (clause.activity() > 1e20f) {
+            // Rescale all activities to avoid overflows
+            for (ClauseRef learnt : mLearnts) {
+                mArena[learnt].setActivity(mArena[learnt].activity() * 1e-20f);
+            }
+
+            mClauseIncrement *= 1e-20f;
+        }
+
+        if (clause.tier() != ClauseTier::Core) {
+            const unsigned lbd = computeLbd({clause.begin(), clause.end()});
+            if (lbd < clause.lbd()) {
+                clause.setLbd(lbd);
+                clause.setTier(std::min(clause.tier(), tierOf(lbd)));
+            }
+        }
     }
-    // Last assigned literal
-    Literal lit = mUnitQueue.back();
-    // Remove it from queue & unassign it
-    mUnitQueue.pop_back();
-    mModel[var(lit).get()] = TruthValue::Undefined;
 
-    // Attempt to assign its negation
-    Literal flipped = lit.negate();
-    if (!assign(flipped)) {
+    bool Solver::isLocked(ClauseRef cref) const {
+        const ArenaClause &clause = mArena[cref];
+        // The implied literal of a long clause is always the first literal. Binary clauses imply either literal
+        for (std::size_t i = 0; i < std::min<std::size_t>(clause.size(), 2); ++i) {
+            if (mReason[var(clause[i]).get()] == cref && satisfied(clause[i])) {
+                return true;
+            }
+        }
+
         return false;
     }
-    return true;
-}
 
+    void Solver::reduceLearnts() {
+        std::vector<ClauseRef> candidates;
+        for (ClauseRef cref : mLearnts) {
+            ArenaClause &clause = mArena[cref];
+            if (clause.tier() == ClauseTier::Tier2 && !clause.used()) {
+                clause.setTier(ClauseTier::Local);
+            } else if (clause.tier() == ClauseTier::Local && !isLocked(cref)) {
+                candidates.push_back(cref);
+            }
+
+            clause.setUsed(false);
+        }
+
+        std::ranges::sort(candidates, {}, [this](ClauseRef cref) { return mArena[cref].activity(); });
+        for (std::size_t i = 0; i < candidates.size() / 2; ++i) {
+            if (mProof != nullptr) {
+                const ArenaClause &clause = mArena[candidates[i]];
+                mProof->remove(clause.id(), std::span(clause.begin(), clause.end()));
+            }
+
+            mArena.free(candidates[i]);
+        }
+
+        std::erase_if(mLearnts, [this](ClauseRef cref) { return mArena[cref].deleted(); });
+        collectGarbage();
+    }
+
+    void Solver::subsumeLearnts() {
+        Subsumption subsumption(mModel.size());
+        std::vector<ClauseRef> refs;
+        auto add = [&](ClauseRef cref) {
+            const ArenaClause &clause = mArena[cref];
+            if (std::ranges::any_of(clause, [this](Literal l) { return satisfied(l); })) {
+                return;
+            }
+
+            mClauseBuffer.clear();
+            std::ranges::copy_if(clause, std::back_inserter(mClauseBuffer), [this](Literal l) {
+                return !falsified(l);
+            });
+
+            // Problem clauses only subsume or strengthen learned clauses
+            subsumption.add(mClauseBuffer, clause.learnt());
+            refs.push_back(cref);
+        };
+
+        std::ranges::for_each(mClauses, add);
+        std::ranges::for_each(mLearnts, add);
+        subsumption.run();
+        // Strengthening clauses are visited first, so the proof refers to their strengthened versions
+        std::vector<std::uint64_t> ids(refs.size());
+        for (std::uint32_t i : subsumption.order()) {
+            ids[i] = mArena[refs[i]].id();
+            const std::size_t other = subsumption.strengthenedBy(i);
+            if (!subsumption.subsumed(i) && other == Subsumption::None) {
+                continue;
+            }
+
+            ++mSubsumedLearnts;
+            if (other != Subsumption::None) {
+                // The strengthened clause is the resolvent of both clauses and replaces the original clause
+                const auto literals = subsumption.clause(i);
+                const ArenaClause &clause = mArena[refs[i]];
+                const unsigned lbd = std::min<unsigned>(clause.lbd(), static_cast<unsigned>(literals.size()));
+                const float activity = clause.activity();
+                const bool used = clause.used();
+                const std::uint64_t id = derivedId();
+                if (mProof != nullptr) {
+                    mHints.clear();
+                    if (mProof->lrat()) {
+                        // Unit clauses of the level 0 literals that were left out, each one only once
+                        proveUnits();
+                        mSeenStamp += 2;
+                        for (ClauseRef cref : {refs[other], refs[i]}) {
+                            for (Literal l : mArena[cref]) {
+                                if (falsified(l) && mSeen[var(l).get()] != mSeenStamp) {
+                                    mSeen[var(l).get()] = mSeenStamp;
+                                    mHints.push_back(mUnitIds[var(l).get()]);
+                                }
+                            }
+                        }
+
+                        mHints.push_back(ids[other]);
+                        mHints.push_back(ids[i]);
+                    }
+
+                    mProof->add(id, literals, mHints);
+                }
+
+                if (literals.size() == 1) {
+                    assign(literals[0], NoClause);
+                    if (!mUnitIds.empty()) {
+                        mUnitIds[var(literals[0]).get()] = id;
+                    }
+                } else {
+                    const ClauseRef cref = mArena.alloc(literals, true);
+                    mArena[cref].setId(id);
+                    mArena[cref].setLbd(lbd);
+                    mArena[cref].setTier(tierOf(lbd));
+                    mArena[cref].setActivity(activity);
+                    mArena[cref].setUsed(used);
+                    mLearnts.push_back(cref);
+                    attachClause(cref);
+                }
+
+                if (mProof != nullptr) {
+                    const ArenaClause &original = mArena[refs[i]];
+                    mProof->remove(original.id(), std::span(original.begin(), original.end()));
+                }
 
-bool Solver::allVariablesAssigned() const {
-    for (const auto& tv : mModel) {
-        if (tv == TruthValue::Undefined) {
+                ids[i] = id;
+            } else if (mProof != nullptr) {
+                const ArenaClause &clause = mArena[refs[i]];
+                mProof->remove(clause.id(), std::span(clause.begin(), clause.end()));
+            }
+
+            mArena.free(refs[i]);
+        }
+
+        std::erase_if(mLearnts, [this](ClauseRef cref) { return mArena[cref].deleted(); });
+        collectGarbage();
+    }
+
+    bool Solver::probe() {
+        if (ClauseRef conflict = propagate(); conflict != NoClause) {
+            mOk = false;
+            const ArenaClause &clause = mArena[conflict];
+            logEmptyClause(std::span(clause.begin(), clause.end()), clause.id());
             return false;
         }
+
+        // Binary clauses containing ¬l are the implication edges leaving l, binary clauses containing l the edges
+        // entering l
+        std::vector<Variable> candidates;
+        for (unsigned x = 0; x < mModel.size(); ++x) {
+            const bool root = std::ranges::any_of(std::array{pos(Variable(x)), neg(Variable(x))}, [this](Literal l) {
+                return !mBinaryWatchers[indexOf(l.negate())].empty() && mBinaryWatchers[indexOf(l)].empty();
+            });
+
+            if (root) {
+                candidates.emplace_back(x);
+            }
+        }
+
+        const Phases phases = mPhases;
+        std::vector<bool> implied(2 * mModel.size(), false);
+        std::vector<Literal> positive;
+        std::vector<Literal> common;
+        std::vector<std::uint64_t> positiveIds;
+        std::vector<std::uint64_t> negativeIds;
+        std::size_t steps = 0;
+        for (Variable x : candidates) {
+            if (!mOk || steps >= ProbeLimit || mStop.stop_requested()) {
+                break;
+            }
+
+            if (val(x) != TruthValue::Undefined || !probeLiteral(pos(x))) {
+                continue;
+            }
+
+            positive.assign(mTrail.begin() + static_cast<std::ptrdiff_t>(mTrailLim.front() + 1), mTrail.end());
+            steps += positive.size() + 1;
+            unassignBack(0);
+            if (!probeLiteral(neg(x))) {
+                continue;
+            }
+
+            steps += mTrail.size() - mTrailLim.front();
+            common.clear();
+            for (Literal u : positive) {
+                implied[indexOf(u)] = true;
+            }
+
+            for (std::size_t i = mTrailLim.front() + 1; i < mTrail.size(); ++i) {
+                if (implied[indexOf(mTrail[i])]) {
+                    common.push_back(mTrail[i]);
+                }
+            }
+
+            for (Literal u : positive) {
+                implied[indexOf(u)] = false;
+            }
+
+            if (common.empty()) {
+                unassignBack(0);
+                continue;
+            }
+
+            if (mProof != nullptr) {
+                // Each common implication u is the resolvent of (x or u) and (¬x or u). Both binary clauses are
+                // derived while the respective polarity of x is assigned
+                negativeIds.clear();
+                for (Literal u : common) {
+                    if (mProof->lrat()) {
+                        collectImplicationHints(neg(x), u);
+                    }
+
+                    negativeIds.push_back(derivedId());
+                    mProof->add(negativeIds.back(), std::array{u, pos(x)}, mHints);
+                }
+
+                unassignBack(0);
+                mTrailLim.push_back(mTrail.size());
+                assign(pos(x), NoClause);
+                [[maybe_unused]] const ClauseRef conflict = propagate();
+                assert(conflict == NoClause);
+                positiveIds.clear();
+                for (Literal u : common) {
+                    assert(satisfied(u));
+                    if (mProof->lrat()) {
+                        collectImplicationHints(pos(x), u);
+                    }
+
+                    positiveIds.push_back(derivedId());
+                    mProof->add(positiveIds.back(), std::array{u, neg(x)}, mHints);
+                }
+            }
+
+            unassignBack(0);
+            for (std::size_t i = 0; i < common.size(); ++i) {
+                const Literal u = common[i];
+                assign(u, NoClause);
+                ++mProbingUnits;
+                if (mProof != nullptr) {
+                    const std::uint64_t id = derivedId();
+                    mProof->add(id, std::span(&u, 1), std::array{positiveIds[i], negativeIds[i]});
+                    mProof->remove(positiveIds[i], std::array{u, neg(x)});
+                    mProof->remove(negativeIds[i], std::array{u, pos(x)});
+                    if (!mUnitIds.empty()) {
+                        mUnitIds[var(u).get()] = id;
+                    }
+                }
+            }
+
+            if (ClauseRef conflict = propagate(); conflict != NoClause) {
+                mOk = false;
+                const ArenaClause &clause = mArena[conflict];
+                logEmptyClause(std::span(clause.begin(), clause.end()), clause.id());
+            }
+        }
+
+        mPhases = phases;
+        return mOk;
+    }
+
+    bool Solver::probeLiteral(Literal l) {
+        mTrailLim.push_back(mTrail.size());
+        assign(l, NoClause);
+        if (ClauseRef conflict = propagate(); conflict != NoClause) {
+            // All literals of the learned clause except the first UIP are fixed at level 0, so the clause is unit
+            std::vector<Literal> learnt;
+            analyze(conflict, learnt);
+            assert(learnt.size() == 1);
+            if (mProof != nullptr && mProof->lrat()) {
+                collectHints(conflict, learnt);
+            }
+
+            const std::uint64_t id = derivedId();
+            if (mProof != nullptr) {
+                mProof->add(id, learnt, mHints);
+            }
+
+            unassignBack(0);
+            assign(learnt[0], NoClause);
+            ++mProbingUnits;
+            if (!mUnitIds.empty()) {
+                mUnitIds[var(learnt[0]).get()] = id;
+            }
+
+            if (conflict = propagate(); conflict != NoClause) {
+                mOk = false;
+                const ArenaClause &clause = mArena[conflict];
+                logEmptyClause(std::span(clause.begin(), clause.end()), clause.id());
+            }
+
+            return false;
+        }
+
+        // Binary clauses are propagated first, so the hyper-binary resolvents are not implied by binary clauses yet.
+        // Their number is bounded by the number of problem clauses
+        for (std::size_t i = mTrailLim.back() + 1; i < mTrail.size() && mHyperBinaries < mClauses.size(); ++i) {
+            const Literal u = mTrail[i];
+            if (mArena[mReason[var(u).get()]].size() == 2) {
+                continue;
+            }
+
+            const std::array resolvent{u, l.negate()};
+            if (mProof != nullptr && mProof->lrat()) {
+                collectImplicationHints(l, u);
+            }
+
+            const std::uint64_t id = derivedId();
+            if (mProof != nullptr) {
+                mProof->add(id, resolvent, mHints);
+            }
+
+            const ClauseRef cref = mArena.alloc(resolvent, true);
+            mArena[cref].setId(id);
+            mArena[cref].setLbd(CoreLbd);
+            mArena[cref].setTier(ClauseTier::Core);
+            mArena[cref].setActivity(mClauseIncrement);
+            mLearnts.push_back(cref);
+            attachClause(cref);
+            ++mHyperBinaries;
+        }
+
+        return true;
+    }
+
+    void Solver::collectImplicationHints(Literal decision, Literal l) {
+        // The clause is derived like a learned clause whose conflict is the reason of l
+        collectHints(mReason[var(l).get()], std::array{decision.negate(), l});
+    }
+
+    bool Solver::findXors() {
+        if (mProof != nullptr) {
+            return true;
+        }
+
+        std::vector<std::vector<Literal>> clauses;
+        for (ClauseRef cref : mClauses) {
+            const ArenaClause &clause = mArena[cref];
+            if (!clause.deleted() && clause.size() >= 2 && clause.size() <= MaxXorSize) {
+                clauses.emplace_back(clause.begin(), clause.end());
+            }
+        }
+
+        const auto xors = recover_xors(clauses, MaxXorSize);
+        std::vector<bool> used(mModel.size(), false);
+        std::size_t numColumns = 0;
+        for (const auto &constraint : xors) {
+            for (Variable x : constraint.variables) {
+                numColumns += !used[x.get()];
+                used[x.get()] = true;
+            }
+        }
+
+        // A single constraint is propagated just as well by its clauses
+        if (xors.size() < 2 || xors.size() * numColumns > MaxXorMatrix) {
+            return true;
+        }
+
+        mNumXors = xors.size();
+        mGaussJordan.emplace(xors, mModel.size());
+        if (mGaussJordan->inconsistent()) {
+            mOk = false;
+            return false;
+        }
+
+        // The engine has to know all literals fixed so far
+        for (Literal l : mTrail) {
+            if (!mGaussJordan->assign(var(l), mModel)) {
+                mOk = false;
+                return false;
+            }
+
+            for (std::size_t i = 0; i < mGaussJordan->numImplied(); ++i) {
+                const auto explanation = mGaussJordan->implied(i);
+                mXorImplied.insert(mXorImplied.end(), explanation.begin(), explanation.end());
+                mXorImpliedEnds.push_back(mXorImplied.size());
+            }
+        }
+
+        for (Literal l : mGaussJordan->units()) {
+            if (!assign(l, NoClause)) {
+                mOk = false;
+                return false;
+            }
+        }
+
+        if (propagate() != NoClause) {
+            mOk = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    ClauseRef Solver::propagateXors() {
+        // Assignments may append further explanations, the buffer is indexed since it may be reallocated
+        for (std::size_t i = 0; i < mXorImpliedEnds.size() && mXorConflict.empty(); ++i) {
+            const std::size_t begin = i == 0 ? 0 : mXorImpliedEnds[i - 1];
+            const auto explanation = std::span(mXorImplied).subspan(begin, mXorImpliedEnds[i] - begin);
+            if (satisfied(explanation[0])) {
+                continue;
+            }
+
+            // An implied literal that is falsified already turns the explanation into a conflict
+            if (falsified(explanation[0])) {
+                mXorConflict.assign(explanation.begin(), explanation.end());
+                break;
+            }
+
+            assign(explanation[0], addExplanation(explanation, true));
+        }
+
+        mXorImplied.clear();
+        mXorImpliedEnds.clear();
+        if (mXorConflict.empty()) {
+            return NoClause;
+        }
+
+        const ClauseRef conflict = addExplanation(mXorConflict, false);
+        mXorConflict.clear();
+        // Conflict analysis requires a literal of the current decision level
+        unassignBack(mLevel[var(mArena[conflict][0]).get()]);
+        return conflict;
+    }
+
+    ClauseRef Solver::addExplanation(std::span<const Literal> literals, bool implication) {
+        mClauseBuffer.assign(literals.begin(), literals.end());
+        auto byLevel = [this](Literal a, Literal b) { return mLevel[var(a).get()] > mLevel[var(b).get()]; };
+        const auto watched = mClauseBuffer.begin() + (implication ? 1 : 0);
+        std::partial_sort(watched, watched + 1, mClauseBuffer.end(), byLevel);
+        if (!implication) {
+            std::partial_sort(watched + 1, watched + 2, mClauseBuffer.end(), byLevel);
+        }
+
+        const ClauseRef cref = mArena.alloc(mClauseBuffer, true);
+        ArenaClause &clause = mArena[cref];
+        clause.setId(derivedId());
+        // The implied literal is not assigned yet, so the size serves as bound of the LBD
+        clause.setLbd(static_cast<unsigned>(mClauseBuffer.size()));
+        clause.setTier(ClauseTier::Local);
+        mLearnts.push_back(cref);
+        mXorReasons.push_back(cref);
+        attachClause(cref);
+        return cref;
+    }
+
+    void Solver::dropXorReasons() {
+        for (ClauseRef cref : mXorReasons) {
+            if (!mArena[cref].used() && !isLocked(cref)) {
+                mArena.free(cref);
+            }
+        }
+
+        mXorReasons.clear();
+        std::erase_if(mLearnts, [this](ClauseRef cref) { return mArena[cref].deleted(); });
+        collectGarbage();
+    }
+
+    void Solver::collectGarbage() {
+        auto isDeleted = [this](const auto &watcher) { return mArena[watcher.clause].deleted(); };
+        std::erase_if(mXorReasons, [this](ClauseRef cref) { return mArena[cref].deleted(); });
+
+        for (auto &watchList : mWatchers) {
+            std::erase_if(watchList, isDeleted);
+        }
+
+        for (auto &watchList : mBinaryWatchers) {
+            std::erase_if(watchList, isDeleted);
+        }
+
+        // Compact the arena only if a significant fraction is wasted
+        if (mArena.wasted() * 5 < mArena.size()) {
+            return;
+        }
+
+        ClauseArena compacted;
+        compacted.reserve(mArena.size() - mArena.wasted());
+        // Relocate in watch list order so that clauses watched by the same literal end up close to each other
+        for (auto &watchList : mWatchers) {
+            for (auto &watcher : watchList) {
+                watcher.clause = mArena.relocate(watcher.clause, compacted);
+            }
+        }
+
+        for (auto &watchList : mBinaryWatchers) {
+            for (auto &watcher : watchList) {
+                watcher.clause = mArena.relocate(watcher.clause, compacted);
+            }
+        }
+
+        for (Literal l : mTrail) {
+            auto &reason = mReason[var(l).get()];
+            if (reason != NoClause) {
+                reason = mArena.relocate(reason, compacted);
+            }
+        }
+
+        for (ClauseRef &cref : mClauses) {
+            cref = mArena.relocate(cref, compacted);
+        }
+
+        for (ClauseRef &cref : mLearnts) {
+            cref = mArena.relocate(cref, compacted);
+        }
+
+        for (ClauseRef &cref : mXorReasons) {
+            cref = mArena.relocate(cref, compacted);
+        }
+
+        mArena = std::move(compacted);
+    }
+
+    std::size_t Solver::numConflicts() const {
+        return mConflicts;
+    }
+
+    std::size_t Solver::numLearntClauses() const {
+        return mLearnts.size();
+    }
+
+    std::size_t Solver::numMinimizedLiterals() const {
+        return mMinimizedLiterals;
+    }
+
+    std::size_t Solver::numProbingUnits() const {
+        return mProbingUnits;
+    }
+
+    std::size_t Solver::numHyperBinaries() const {
+        return mHyperBinaries;
+    }
+
+    std::size_t Solver::numXors() const {
+        return mNumXors;
+    }
+
+    std::size_t Solver::numXorPivots() const {
+        return mGaussJordan ? mGaussJordan->numPivots() : 0;
+    }
+
+    std::size_t Solver::numSubsumedLearnts() const {
+        return mSubsumedLearnts;
+    }
+
+    void Solver::reserveClauses(std::size_t numClauses, std::size_t numLiterals) {
+        mReservedIds = std::max(mReservedIds, mNextId + numClauses);
+        mClauses.reserve(mClauses.size() + numClauses);
+        mArena.reserve(mArena.size() + numClauses * ClauseArena::HeaderWords + numLiterals);
+    }
+
+    void Solver::beginBulkAdd() {
+        mBulkAdd = true;
+    }
+
+    void Solver::endBulkAdd() {
+        if (!mBulkAdd) {
+            return;
+        }
+
+        // Count the new watchers of each literal first so that every watch list is allocated only once
+        std::vector<std::uint32_t> numWatchers(mWatchers.size(), 0);
+        std::vector<std::uint32_t> numBinaryWatchers(mBinaryWatchers.size(), 0);
+        for (ClauseRef cref : mPendingAttach) {
+            const ArenaClause &clause = mArena[cref];
+            auto &counts = clause.size() == 2 ? numBinaryWatchers : numWatchers;
+            ++counts[indexOf(clause[0])];
+            ++counts[indexOf(clause[1])];
+        }
+
+        for (std::size_t i = 0; i < mWatchers.size(); ++i) {
+            mWatchers[i].reserve(mWatchers[i].size() + numWatchers[i]);
+            mBinaryWatchers[i].reserve(mBinaryWatchers[i].size() + numBinaryWatchers[i]);
+        }
+
+        for (ClauseRef cref : mPendingAttach) {
+            attachClause(cref);
+        }
+
+        mPendingAttach.clear();
+        mPendingAttach.shrink_to_fit();
+        mBulkAdd = false;
+    }
+
+    std::size_t Solver::numVariables() const {
+        return mModel.size();
+    }
+
+    SolverLoader::SolverLoader(Proof *proof) : mProof(proof) {}
+
+    void SolverLoader::header(std::size_t numVariables, std::size_t numClauses) {
+        mSolver.emplace(static_cast<unsigned>(numVariables));
+        mSolver->setProof(mProof);
+        mSolver->reserveClauses(numClauses);
+        mSolver->beginBulkAdd();
+    }
+
+    void SolverLoader::literal(Literal l) {
+        mClause.push_back(l);
+    }
+
+    void SolverLoader::endClause() {
+        // Once the formula is known to be unsatisfiable, the remaining clauses are irrelevant
+        if (mOk) {
+            mOk = mSolver->addClause(std::span<const Literal>(mClause));
+        }
+
+        mClause.clear();
+    }
+
+    void SolverLoader::clause(std::span<const Literal> literals) {
+        if (mOk) {
+            mOk = mSolver->addClause(literals);
+        }
+    }
+
+    bool SolverLoader::ok() const {
+        return mOk;
+    }
+
+    Solver &SolverLoader::solver() {
+        if (!mSolver) {
+            throw std::runtime_error("no problem header found");
+        }
+
+        mSolver->endBulkAdd();
+        return *mSolver;
+    }
+
+    void Solver::setRestartPolicy(RestartPolicy policy) {
+        mRestarts = Restarts(policy);
+    }
+
+    void Solver::setPolarity(Polarity polarity) {
+        mPhases.setAll(polarity);
+    }
+
+    void Solver::useProbing(bool enable) {
+        mProbing = enable;
+    }
+
+    void Solver::useGaussJordan(bool enable) {
+        mUseGaussJordan = enable;
+    }
+
+    void Solver::useTargetPhases(bool enable) {
+        mPhases.useTarget(enable);
+    }
+
+    void Solver::setStopToken(std::stop_token token) {
+        mStop = std::move(token);
+    }
+
+    bool Solver::interrupted() const {
+        return mInterrupted;
+    }
+
+    void Solver::setConflictLimit(std::size_t limit) {
+        mConflictLimit = limit;
+    }
+
+    void Solver::setMemoryLimit(std::size_t bytes) {
+        mMemoryLimit = bytes;
+    }
+
+    std::size_t Solver::memoryUsage() const {
+        return mArena.size() * sizeof(std::uint32_t) + mModel.size() * VariableBytes;
+    }
+
+    std::optional<std::size_t> Solver::lookahead(std::span<const Literal> assumptions, Literal l) {
+        endBulkAdd();
+        unassignBack(0);
+        if (!mOk) {
+            return std::nullopt;
+        }
+
+        if (ClauseRef conflict = propagate(); conflict != NoClause) {
+            mOk = false;
+            const ArenaClause &clause = mArena[conflict];
+            logEmptyClause(std::span(clause.begin(), clause.end()), clause.id());
+            return std::nullopt;
+        }
+
+        // All assumptions share one decision level, l is propagated on the next one
+        std::optional<std::size_t> implied;
+        mTrailLim.push_back(mTrail.size());
+        const bool consistent = std::ranges::all_of(assumptions, [this](Literal a) { return assign(a, NoClause); });
+        if (consistent && propagate() == NoClause) {
+            const std::size_t before = mTrail.size();
+            mTrailLim.push_back(before);
+            if (satisfied(l)) {
+                implied = 0;
+            } else if (assign(l, NoClause) && propagate() == NoClause) {
+                implied = mTrail.size() - before;
+            }
+        }
+
+        unassignBack(0);
+        return implied;
+    }
+
+    void Solver::setExchange(ExchangePort *port) {
+        if (port != nullptr && mProof != nullptr) {
+            throw std::runtime_error("Clause sharing cannot be combined with proof logging");
+        }
+
+        mExchange = port;
+    }
+
+    bool Solver::importSharedClauses() {
+        mExchange->receive([this](std::span<const Literal> literals, unsigned lbd) {
+            if (!mOk || std::ranges::any_of(literals, [this](Literal l) { return satisfied(l); })) {
+                return;
+            }
+
+            // Learned clauses of other solvers are free of duplicates and tautologies, only level 0 is simplified
+            auto &lits = mClauseBuffer;
+            lits.assign(literals.begin(), literals.end());
+            std::erase_if(lits, [this](Literal l) { return falsified(l); });
+            if (lits.empty()) {
+                mOk = false;
+            } else if (lits.size() == 1) {
+                assign(lits[0], NoClause);
+            } else {
+                lbd = std::min<unsigned>(lbd, static_cast<unsigned>(lits.size()));
+                ClauseRef cref = mArena.alloc(lits, true);
+                mArena[cref].setLbd(lbd);
+                mArena[cref].setTier(tierOf(lbd));
+                mArena[cref].setActivity(mClauseIncrement);
+                mArena[cref].setImported(true);
+                mLearnts.push_back(cref);
+                attachClause(cref);
+            }
+        });
+
+        return mOk;
+    }
+
+    std::size_t Solver::numRestarts() const {
+        return mRestarts.numRestarts();
+    }
+
+    void Solver::logEmptyClause(std::span<const Literal> falsified, std::uint64_t id) {
+        if (mProof == nullptr) {
+            return;
+        }
+
+        mHints.clear();
+        if (mProof->lrat()) {
+            proveUnits();
+            for (Literal l : falsified) {
+                mHints.push_back(mUnitIds[var(l).get()]);
+            }
+
+            mHints.push_back(id);
+        }
+
+        mProof->add(derivedId(), {}, mHints);
+    }
+
+    std::uint64_t Solver::derivedId() {
+        mNextId = std::max(mNextId, mReservedIds);
+        return mNextId++;
+    }
+
+    void Solver::proveUnits() {
+        const std::size_t end = decisionLevel() == 0 ? mTrail.size() : mTrailLim.front();
+        for (; mProvedUnits < end; ++mProvedUnits) {
+            const Literal l = mTrail[mProvedUnits];
+            const auto v = var(l).get();
+            if (mUnitIds[v] != 0) {
+                continue;
+            }
+
+            // The other literals of the reason were fixed earlier, so their unit clauses exist already
+            assert(mReason[v] != NoClause);
+            const ArenaClause &reason = mArena[mReason[v]];
+            mReasonHints.clear();
+            for (Literal q : reason) {
+                if (var(q).get() != v) {
+                    mReasonHints.push_back(mUnitIds[var(q).get()]);
+                }
+            }
+
+            mReasonHints.push_back(reason.id());
+            mUnitIds[v] = derivedId();
+            mProof->add(mUnitIds[v], std::span(&l, 1), mReasonHints);
+        }
+    }
+
+    void Solver::collectHints(ClauseRef conflict, std::span<const Literal> learnt) {
+        proveUnits();
+        mHints.clear();
+        mReasonHints.clear();
+        // The literals of the learned clause are falsified by the checker, all other literals on the paths to the
+        // conflict have to be implied by their reasons. A depth first search emits each reason after the reasons of
+        // the literals it depends on
+        mSeenStamp += 2;
+        for (Literal l : learnt) {
+            mSeen[var(l).get()] = mSeenStamp;
+        }
+
+        auto visit = [this](Literal q) {
+            const auto v = var(q).get();
+            if (mSeen[v] == mSeenStamp) {
+                return;
+            }
+
+            mSeen[v] = mSeenStamp;
+            if (mLevel[v] == 0) {
+                mHints.push_back(mUnitIds[v]);
+            } else {
+                mMinimizeStack.emplace_back(q, 0);
+            }
+        };
+
+        mMinimizeStack.clear();
+        for (Literal root : mArena[conflict]) {
+            visit(root);
+            while (!mMinimizeStack.empty()) {
+                auto &[current, next] = mMinimizeStack.back();
+                const ArenaClause &reason = mArena[mReason[var(current).get()]];
+                if (next == reason.size()) {
+                    mReasonHints.push_back(reason.id());
+                    mMinimizeStack.pop_back();
+                    continue;
+                }
+
+                const Literal q = reason[next++];
+                if (var(q) != var(current)) {
+                    visit(q);
+                }
+            }
+        }
+
+        mHints.insert(mHints.end(), mReasonHints.begin(), mReasonHints.end());
+        mHints.push_back(mArena[conflict].id());
+    }
+
+    void Solver::setProof(Proof *proof) {
+        mProof = proof;
+        mUnitIds.assign(proof != nullptr && proof->lrat() ? mModel.size() : 0, 0);
+    }
+
+    void Solver::setHeuristic(Heuristic heuristic) {
+        mHeuristic = std::move(heuristic);
+    }
+
+    Literal Solver::selectLit() {
+        const std::size_t numOpen = mModel.size() - mTrail.size();
+        Variable v = mHeuristic.isValid() ? mHeuristic(mModel, numOpen) : mActivity(mModel, numOpen);
+        return mPhases.decide(v);
+    }
+
+    // Helper to revert all assignments made above the given decision level
+    void Solver::unassignBack(unsigned level) {
+        if (decisionLevel() <= level) {
+            return;
+        }
+
+        const std::size_t checkpoint = mTrailLim[level];
+        while (mTrail.size() > checkpoint) {
+            Literal lit = mTrail.back();
+            mTrail.pop_back();
+            mModel[var(lit).get()] = TruthValue::Undefined;
+            mReason[var(lit).get()] = NoClause;
+            mActivity.reinsert(var(lit));
+            mPhases.save(lit);
+        }
+
+        mTrailLim.resize(level);
+        mQueueHead = mBinaryQueueHead = mTrail.size();
+        mXorImplied.clear();
+        mXorImpliedEnds.clear();
+        mXorConflict.clear();
+    }
+
+    bool Solver::allVariablesAssigned() const {
+        return mTrail.size() == mModel.size();
     }
-    return true;
-}
 
-} // namespace sat
\ No newline at end of file
+} // namespace sat
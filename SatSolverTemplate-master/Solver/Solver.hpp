@@ -8,20 +8,51 @@
     #ifndef SOLVER_HPP
     #define SOLVER_HPP
 
-    #include <memory>
-    #include <deque>
     #include <vector>
+    #include <span>
+    #include <cstdint>
+    #include <optional>
+    #include <ranges>
+    #include <stop_token>
+    #include <limits>
     #include "basic_structures.hpp"
     #include "Clause.hpp"
+    #include "ClauseArena.hpp"
     #include "heuristics.hpp"
+    #include "restarts.hpp"
+    #include "proof.hpp"
+    #include "ClauseExchange.hpp"
+    #include "GaussJordan.hpp"
 
     namespace sat {
 
-        using ClausePointer = std::shared_ptr<Clause>;
-        using ConstClausePointer = std::shared_ptr<const Clause>;
+        /**
+         * @brief Entry of a watch list
+         * @details Besides the watching clause, each entry caches some other literal of that clause (the blocker).
+         * If the blocker is satisfied, the clause is satisfied as well and can be skipped without reading the clause
+         * from memory.
+         */
+        struct Watcher {
+            ClauseRef clause;
+            Literal blocker;
+        };
+
+        /**
+         * @brief Implication edge of a binary clause
+         * @details Binary clauses are not watched like longer clauses. Instead, every literal has a list of implication
+         * edges: if the literal is falsified, all implied literals must be satisfied. The clause itself is only kept as
+         * reason for conflict analysis.
+         */
+        struct BinaryWatcher {
+            Literal implied;
+            ClauseRef clause;
+        };
 
         /**
          * @brief Main solver class
+         * @details Implements conflict driven clause learning (CDCL): on each conflict, the first unique implication
+         * point (1UIP) clause is derived from the implication graph, added to the clause database and the search
+         * backjumps to the asserting level of that clause.
          */
         class Solver {
         private:
@@ -29,16 +60,23 @@
             // True, False, or Undefined (unassigned).
             std::vector<TruthValue> mModel;
 
-            // We store all clauses in shared pointers.
-            std::vector<ClausePointer> mClauses;
+            // All clauses live in one contiguous arena and are referenced by ClauseRef
+            ClauseArena mArena;
+
+            // References to the problem clauses
+            std::vector<ClauseRef> mClauses;
+
+            // Clauses derived during conflict analysis
+            std::vector<ClauseRef> mLearnts;
 
             // For watch-literal propagation:
             // watchers[literal_id] is a list of clauses currently watching that literal.
             // If lit has ID = l.get(), watchers[lit.get()] returns all clauses that have lit as a watcher.
-            std::vector<std::vector<ClausePointer>> mWatchers;
+            std::vector<std::vector<Watcher>> mWatchers;
 
-            // A queue (FIFO) of newly assigned literals for unit propagation.
-            std::deque<Literal> mUnitQueue;
+            // Implication lists of binary clauses:
+            // mBinaryWatchers[lit.get()] contains the literals implied by binary clauses if lit is falsified
+            std::vector<std::vector<BinaryWatcher>> mBinaryWatchers;
 
             // Helper function to map a Literal to its "index" for watchers.
             // Since we store the ID in the literal, we can just use that directly.
@@ -46,14 +84,288 @@
                 return static_cast<std::size_t>(l.get());
             }
 
-            std::vector<size_t> mTrail;      // Decision level tracking
-            std::vector<Literal> mDecisions; // Track decision literals
-            Heuristic mHeuristic;            // Variable selection heuristic
-            unsigned mDecisionLevel; // Add this line
-            // Helper method for backtracking
-            void unassignBack(size_t level);
+            std::vector<Literal> mTrail;         // All assigned literals in assignment order
+            std::vector<std::size_t> mTrailLim;  // Position in mTrail where each decision level starts
+            std::size_t mQueueHead = 0;          // Next literal in mTrail to propagate over long clauses
+            std::size_t mBinaryQueueHead = 0;    // Next literal in mTrail to propagate over binary clauses
+            std::vector<unsigned> mLevel;        // Decision level of each assigned variable
+            std::vector<ClauseRef> mReason;      // Clause that implied each variable (NoClause for decisions)
+            std::vector<std::uint64_t> mSeen;    // Per variable analysis marks, valid if >= mSeenStamp
+            std::uint64_t mSeenStamp = 0;        // Mark of the current conflict analysis (mSeenStamp + 1: poisoned)
+            std::vector<std::pair<Literal, std::uint32_t>> mMinimizeStack; // DFS stack of the clause minimization
+            std::size_t mMinimizedLiterals = 0;  // Number of literals removed from learned clauses
+            std::vector<Literal> mFailedAssumptions; // Assumptions responsible for the last UNSAT result
+            std::vector<Literal> mClauseBuffer;  // Scratch buffer used to normalize added clauses
+            std::vector<ClauseRef> mPendingAttach; // Clauses added in bulk that are not watched yet
+            bool mBulkAdd = false;               // Whether added clauses are only watched at the end of a bulk add
+            VSIDS mActivity;                     // Conflict driven variable activities (default heuristic)
+            Heuristic mHeuristic;                // Optional variable selection heuristic replacing mActivity
+            Phases mPhases;                      // Saved, target and best polarities of the decisions
+            Restarts mRestarts;                  // Restart policy driven by the conflicts
+            std::vector<std::uint64_t> mLevelStamp; // Per decision level marks used to compute LBDs
+            std::uint64_t mStamp = 0;            // Current mark value for mLevelStamp
+            float mClauseIncrement = 1;          // Activity bump of learned clauses
+            std::size_t mConflicts = 0;          // Number of conflicts so far
+            std::size_t mNextReduce = FirstReduce; // Conflict count at which the learned clauses are reduced next
+            std::size_t mNumReductions = 0;      // Number of learned clause database reductions so far
+            std::size_t mNextSubsume = SubsumeInterval; // Conflict count at which the learned clauses are subsumed next
+            std::size_t mSubsumedLearnts = 0;    // Number of learned clauses removed or strengthened by subsumption
+            bool mProbing = true;                // Whether the first call to solve() probes the roots (see probe())
+            bool mProbed = false;                // Whether probe() has run already
+            std::size_t mProbingUnits = 0;       // Number of literals fixed at level 0 by probing
+            std::size_t mHyperBinaries = 0;      // Number of binary clauses added by hyper-binary resolution
+            bool mUseGaussJordan = true;         // Whether the first call to solve() looks for XOR constraints
+            bool mSearchedXors = false;          // Whether findXors() has run already
+            std::size_t mNumXors = 0;            // Number of XOR constraints recovered from the problem clauses
+            std::optional<GaussJordan> mGaussJordan; // Optional propagation of the XOR constraints (see findXors())
+            std::vector<Literal> mXorImplied;    // Explanations of XOR implications not assigned yet, back to back
+            std::vector<std::size_t> mXorImpliedEnds;
+            std::vector<Literal> mXorConflict;   // Explanation of a falsified XOR constraint
+            std::vector<ClauseRef> mXorReasons;  // Explanation clauses added since the last dropXorReasons()
+            Proof *mProof = nullptr;             // Optional proof log of learned and deleted clauses
+            std::uint64_t mNextId = 1;           // Id of the next added or derived clause (see ArenaClause::id())
+            std::uint64_t mReservedIds = 1;      // Ids below are reserved for problem clauses (see reserveClauses())
+            std::vector<std::uint64_t> mUnitIds; // LRAT: id of the unit clause of each variable fixed at level 0
+            std::size_t mProvedUnits = 0;        // LRAT: prefix of the level 0 trail whose unit clauses are in the proof
+            std::vector<std::uint64_t> mHints;   // LRAT: hints of the clause that is derived next
+            std::vector<std::uint64_t> mReasonHints; // LRAT: scratch buffer for hints
+            std::stop_token mStop;               // Cooperative cancellation of solve()
+            ExchangePort *mExchange = nullptr;   // Optional connection for sharing learned clauses with other solvers
+            bool mInterrupted = false;           // Whether the last call to solve() was cancelled
+            std::size_t mConflictLimit = std::numeric_limits<std::size_t>::max(); // solve() gives up at this count
+            std::size_t mMemoryLimit = std::numeric_limits<std::size_t>::max(); // solve() gives up above (bytes)
+
+            static constexpr unsigned CoreLbd = 2;             // Learned clauses up to this LBD are kept forever
+            static constexpr unsigned Tier2Lbd = 6;            // Learned clauses up to this LBD are kept while used
+            static constexpr std::size_t FirstReduce = 2000;   // Conflicts before the first reduction
+            static constexpr std::size_t ReduceIncrement = 300;// Growth of the interval between reductions
+            static constexpr std::size_t SubsumeInterval = 10000; // Conflicts between subsumption rounds
+            static constexpr std::size_t ProbeLimit = 10'000'000; // Probing stops after this many assignments
+            static constexpr std::size_t MaxXorSize = 6;       // Larger XOR constraints are not searched for
+            static constexpr std::size_t MaxXorMatrix = std::size_t(1) << 24; // Max bits of the Gauss-Jordan matrix
+            static constexpr std::size_t MaxXorReasons = 10000; // Explanation clauses kept before dropXorReasons()
+            static constexpr float ClauseDecay = 0.999f;       // Decay factor of learned clause activities
+            static constexpr std::size_t VariableBytes = 128;  // Estimated memory per variable without clauses
+            bool mOk = true;                     // false once the clause set is known to be unsatisfiable
+
+            /**
+             * Current decision level (0 if no decision has been made)
+             */
+            unsigned decisionLevel() const;
+
+            /**
+             * Assigns a literal and records the clause that implied it
+             * @param l literal to assign
+             * @param reason implying clause or NoClause for decisions and unit facts
+             * @return false if l is already falsified, true otherwise
+             */
+            bool assign(Literal l, ClauseRef reason);
+
+            /**
+             * Adds the watchers or implication edges of a clause with at least two literals
+             * @param cref the clause to watch. Its first two literals are watched
+             */
+            void attachClause(ClauseRef cref);
+
+            /**
+             * Propagates all pending literals on the trail. Binary implications of all pending literals are propagated
+             * first before any longer clause is visited
+             * @return the conflicting clause or NoClause if a fixpoint was reached
+             */
+            ClauseRef propagate();
+
+            /**
+             * Derives the first-UIP clause from the given conflict
+             * @param conflict the falsified clause
+             * @param learnt output: the learned clause, asserting literal first, a literal of the backjump level second
+             * @return backjump level
+             */
+            unsigned analyze(ClauseRef conflict, std::vector<Literal> &learnt);
+
+            /**
+             * Removes all literals from a learned clause that are implied by its other literals
+             * @param learnt the learned clause, all literals must be marked as seen
+             */
+            void minimize(std::vector<Literal> &learnt);
+
+            /**
+             * Checks whether a literal of the learned clause is implied by the other literals of the learned clause.
+             * The results are cached in the seen marks of the visited variables
+             * @param l literal of the learned clause with a reason
+             * @param abstractLevels abstraction of the decision levels of the learned clause
+             * @return true if l can be removed from the learned clause
+             */
+            bool isRedundant(Literal l, std::uint32_t abstractLevels);
+
+            /**
+             * Abstraction of the decision level of a variable used to quickly rule out redundancy checks
+             */
+            std::uint32_t abstractLevel(Variable x) const;
+
+            /**
+             * Computes the assumptions that imply the negation of a falsified assumption and stores them together
+             * with the falsified assumption in mFailedAssumptions
+             * @param failed the falsified assumption
+             */
+            void analyzeFinal(Literal failed);
+
+            /**
+             * Computes the literal block distance (number of distinct decision levels) of the given literals
+             * @param literals assigned literals
+             * @return LBD
+             */
+            unsigned computeLbd(std::span<const Literal> literals);
+
+            /**
+             * Adds the clauses that other solvers shared since the last call as learned clauses. Must be called at
+             * decision level 0
+             * @return false if an imported clause is falsified, i.e. the formula is unsatisfiable
+             */
+            bool importSharedClauses();
+
+            /**
+             * Tier of a learned clause with the given LBD
+             */
+            static ClauseTier tierOf(unsigned lbd);
+
+            /**
+             * Notifies the clause database that a clause took part in conflict analysis. Learned clauses are bumped,
+             * marked as used and promoted to a better tier if their LBD decreased
+             * @param cref the clause
+             */
+            void clauseUsed(ClauseRef cref);
+
+            /**
+             * Whether a clause is the reason of a current assignment and must therefore not be deleted
+             * @param cref the clause
+             */
+            bool isLocked(ClauseRef cref) const;
 
-            bool branchFlip();
+            /**
+             * Deletes the less active half of the local tier of learned clauses. Unused tier-2 clauses are moved to
+             * the local tier. Clauses that are reasons of current assignments are never deleted
+             */
+            void reduceLearnts();
+
+            /**
+             * Removes learned clauses that are subsumed by other clauses and strengthens learned clauses by
+             * self-subsuming resolution (see Subsumption). Literals fixed at level 0 are ignored. Must be called at
+             * decision level 0 after propagation
+             */
+            void subsumeLearnts();
+
+            /**
+             * Failed literal probing on the roots of the binary implication graph, i.e. literals that imply other
+             * literals by binary clauses but are not implied by any binary clause themselves. Both polarities of each
+             * candidate variable are propagated on decision level 1:
+             * - if a polarity leads to a conflict, the negated first UIP is fixed at level 0 (failed literal)
+             * - literals implied by both polarities are fixed at level 0 (common implications)
+             * - literals implied by a longer clause are implied by the probed literal alone, so this implication is
+             * added as binary clause (hyper-binary resolution) and found by binary propagation from then on
+             *
+             * All derived clauses are logged in the proof. Saved phases are not changed. Must be called at decision
+             * level 0
+             * @return false if the formula was found to be unsatisfiable
+             */
+            bool probe();
+
+            /**
+             * Propagates a literal on a new decision level for probe(). If this leads to a conflict, the learned unit
+             * clause is added, the search returns to level 0 and propagates it. Otherwise, the level stays open and
+             * hyper-binary resolvents are added for all literals implied by longer clauses
+             * @param l the probed literal, must be unassigned
+             * @return true if l was propagated without conflict
+             */
+            bool probeLiteral(Literal l);
+
+            /**
+             * LRAT: computes the hints of a clause (¬d or l), where l is implied at decision level 1 and d is the
+             * decision (see collectHints)
+             */
+            void collectImplicationHints(Literal decision, Literal l);
+
+            /**
+             * Recovers XOR constraints from the problem clauses (see recover_xors) and sets up their propagation by
+             * Gauss-Jordan elimination, unless proof logging is enabled: the explanation clauses of the XOR
+             * propagation are not derivable by unit propagation. Must be called at decision level 0
+             * @return false if the XOR constraints have no solution under the current assignment
+             */
+            bool findXors();
+
+            /**
+             * Assigns the literals implied by the XOR constraints in the order they were found. Each implication is
+             * justified by its explanation clause, which is added as learned clause
+             * @return the falsified explanation clause on a conflict or NoClause. If all literals of a conflict are
+             * assigned below the current decision level, the search backtracks to the highest of their levels
+             */
+            ClauseRef propagateXors();
+
+            /**
+             * Adds the explanation clause of an XOR implication or conflict as learned clause. The first literal
+             * stays in front for implications, the remaining literals are ordered such that a falsified literal of
+             * the highest decision level is watched
+             * @param literals the explanation
+             * @param implication whether the first literal is implied, otherwise all literals are falsified
+             * @return the clause
+             */
+            ClauseRef addExplanation(std::span<const Literal> literals, bool implication);
+
+            /**
+             * Deletes the explanation clauses added since the last call that neither took part in conflict analysis
+             * nor are reasons of current assignments. The others are kept like any other learned clause
+             */
+            void dropXorReasons();
+
+            /**
+             * Removes watchers of deleted clauses and compacts the clause arena if enough memory is wasted
+             */
+            void collectGarbage();
+
+            /**
+             * Undoes all assignments above the given decision level
+             * @param level decision level to return to
+             */
+            void unassignBack(unsigned level);
+
+            /**
+             * Adds the empty clause to the proof (if any) once the formula is known to be unsatisfiable
+             * @param falsified clause that is falsified at decision level 0
+             * @param id id of the falsified clause
+             */
+            void logEmptyClause(std::span<const Literal> falsified, std::uint64_t id);
+
+            /**
+             * Takes the id of a derived clause. Derived clauses never take the ids of problem clauses announced by
+             * reserveClauses(), even if these clauses are not added due to a conflict
+             */
+            std::uint64_t derivedId();
+
+            /**
+             * LRAT: adds unit clauses to the proof for all literals assigned at level 0 that do not have one yet
+             */
+            void proveUnits();
+
+            /**
+             * LRAT: computes the hints of a learned clause from the implication graph. The hints are the unit clauses
+             * of the level 0 literals involved, followed by the reasons of all implied literals between the learned
+             * clause and the conflict in topological order and finally the conflict itself
+             * @param conflict the conflicting clause
+             * @param learnt the learned clause derived from the conflict
+             */
+            void collectHints(ClauseRef conflict, std::span<const Literal> learnt);
+
+            /**
+             * Starts adding many clauses. Until endBulkAdd() is called, added clauses are not watched, so the watch
+             * lists can be allocated with their final sizes
+             */
+            void beginBulkAdd();
+
+            /**
+             * Watches all clauses added since beginBulkAdd(). Does nothing if no bulk add is in progress
+             */
+            void endBulkAdd();
+
+            friend class SolverLoader;
 
         public:
             /**
@@ -67,11 +379,64 @@
              * @param clause The clause to add
              * @return bool true if clause was successfully added,
              *              false if clause is empty or conflicts immediately with the current model
+             * @note if called after solve(), all decisions (and thus the model) are undone first
              */
             bool addClause(Clause clause);
 
             /**
-             * Returns a reduced set of clauses. Excludes satisfied clauses
+             * @copydoc addClause(Clause)
+             * @param literals literals of the clause
+             */
+            bool addClause(std::span<const Literal> literals);
+
+            /**
+             * Adds multiple clauses at once. Memory for the clauses is reserved up front if the range allows it.
+             * Adding stops at the first clause that conflicts with the current model
+             * @tparam R range of clauses
+             * @param clauses the clauses to add
+             * @return true if all clauses were successfully added, false otherwise
+             */
+            template<std::ranges::input_range R>
+            requires clause_like<std::ranges::range_value_t<R>>
+            bool addClauses(R &&clauses) {
+                if constexpr (std::ranges::forward_range<R>) {
+                    std::size_t numClauses = 0;
+                    std::size_t numLiterals = 0;
+                    for (const auto &clause : clauses) {
+                        ++numClauses;
+                        numLiterals += std::ranges::distance(clause);
+                    }
+
+                    reserveClauses(numClauses, numLiterals);
+                }
+
+                beginBulkAdd();
+                bool ok = true;
+                for (const auto &clause : clauses) {
+                    if (!addClause(std::span<const Literal>(std::ranges::data(clause), std::ranges::size(clause)))) {
+                        ok = false;
+                        break;
+                    }
+                }
+
+                endBulkAdd();
+                return ok;
+            }
+
+            /**
+             * Reserves memory and proof ids for clauses that are about to be added
+             * @param numClauses number of clauses
+             * @param numLiterals total number of literals in these clauses (0 if unknown)
+             */
+            void reserveClauses(std::size_t numClauses, std::size_t numLiterals = 0);
+
+            /**
+             * Number of variables of the problem
+             */
+            std::size_t numVariables() const;
+
+            /**
+             * Returns a reduced set of clauses. Excludes satisfied and duplicate clauses
              * and removes falsified literals from clauses.
              * @return equivalent set of clauses
              */
@@ -113,16 +478,221 @@
             bool unitPropagate();
 
             /**
-             * Main solving method implementing the DPLL algorithm
+             * Main solving method implementing the CDCL algorithm
              * @return true if formula is satisfiable, false otherwise
              */
             bool solve();
 
+            /**
+             * Solves the formula under the given assumptions. The assumptions only hold for this call, while clauses,
+             * learned clauses and heuristic state persist between calls.
+             * @param assumptions literals that are temporarily assumed to be true
+             * @return true if the formula is satisfiable under the assumptions, false otherwise. In the latter case,
+             * failedAssumptions() contains the assumptions responsible
+             */
+            bool solve(std::span<const Literal> assumptions);
+
+            /**
+             * Subset of the assumptions of the last call to solve() that is already unsatisfiable together with the
+             * formula. Empty if the formula itself is unsatisfiable
+             */
+            const std::vector<Literal> &failedAssumptions() const;
+
+            /**
+             * Replaces the default activity based branching heuristic
+             * @param heuristic the variable selection heuristic to use for subsequent decisions. If the wrapper is
+             * empty, the solver falls back to the activity based heuristic
+             */
+            void setHeuristic(Heuristic heuristic);
+
+            /**
+             * Enables proof logging. Must be called before any clause is added
+             * @param proof proof that receives all learned and deleted clauses. Must outlive the solver or be unset
+             * before it is destroyed. nullptr disables proof logging
+             */
+            void setProof(Proof *proof);
+
+            /**
+             * Enables or disables failed literal probing before the first search (see probe()). Enabled by default
+             */
+            void useProbing(bool enable);
+
+            /**
+             * Enables or disables the search for XOR constraints at the first call to solve() and their propagation
+             * by Gauss-Jordan elimination (see GaussJordan). Enabled by default, but never used with proof logging
+             */
+            void useGaussJordan(bool enable);
+
+            /**
+             * Sets the restart policy. The restart state is reset
+             * @param policy restart policy for subsequent searches
+             */
+            void setRestartPolicy(RestartPolicy policy);
+
+            /**
+             * Sets the saved phases of all variables, i.e. the polarities of their next decisions
+             * @param polarity the new phases
+             */
+            void setPolarity(Polarity polarity);
+
+            /**
+             * Enables or disables target phases (see Phases::useTarget). Enabled by default
+             */
+            void useTargetPhases(bool enable);
+
+            /**
+             * Enables cooperative cancellation. solve() checks the token regularly and returns false as soon as a
+             * stop is requested. In that case, interrupted() returns true
+             * @param token stop token, an empty token disables cancellation
+             */
+            void setStopToken(std::stop_token token);
+
+            /**
+             * Whether the last call to solve() was cancelled before a result was found
+             */
+            bool interrupted() const;
+
+            /**
+             * Limits the search. solve() returns false once numConflicts() reaches the limit, interrupted() then
+             * returns true
+             * @param limit total number of conflicts (not per call)
+             */
+            void setConflictLimit(std::size_t limit);
+
+            /**
+             * Limits the memory used by the search. solve() returns false once memoryUsage() exceeds the limit,
+             * interrupted() then returns true
+             * @param bytes maximum memory usage in bytes
+             */
+            void setMemoryLimit(std::size_t bytes);
+
+            /**
+             * Estimate of the memory used by the solver in bytes: the clause arena plus a fixed amount per variable
+             * for assignments, watcher lists and heuristics. Cheap to compute
+             */
+            std::size_t memoryUsage() const;
+
+            /**
+             * Measures the effect of a literal by unit propagation under the given assumptions (lookahead). The
+             * assignment is undone afterwards
+             * @param assumptions literals that are assumed to be true
+             * @param l literal to probe
+             * @return number of literals assigned by propagating l, including l itself (0 if l is already implied by
+             * the assumptions), or std::nullopt if l or the assumptions lead to a conflict
+             */
+            std::optional<std::size_t> lookahead(std::span<const Literal> assumptions, Literal l);
+
+            /**
+             * Enables sharing of learned clauses with other solvers. Short or low-LBD learned clauses are exported as
+             * soon as they are learned, clauses of other solvers are imported when solve() starts and at restarts
+             * @param port connection to the exchange. Must outlive the solver or be unset before it is destroyed.
+             * nullptr disables sharing
+             * @throws std::runtime_error if proof logging is enabled, since imported clauses cannot be justified
+             */
+            void setExchange(ExchangePort *port);
+
+            /**
+             * Number of restarts performed so far
+             */
+            std::size_t numRestarts() const;
+
+            /**
+             * Number of conflicts encountered so far
+             */
+            std::size_t numConflicts() const;
+
+            /**
+             * Number of learned clauses currently in the clause database
+             */
+            std::size_t numLearntClauses() const;
+
+            /**
+             * Number of literals removed from learned clauses by minimization
+             */
+            std::size_t numMinimizedLiterals() const;
+
+            /**
+             * Number of learned clauses removed or strengthened by subsumption
+             */
+            std::size_t numSubsumedLearnts() const;
+
+            /**
+             * Number of literals fixed by failed literal probing, both failed literals and common implications
+             */
+            std::size_t numProbingUnits() const;
+
+            /**
+             * Number of binary clauses added by hyper-binary resolution during probing
+             */
+            std::size_t numHyperBinaries() const;
+
+            /**
+             * Number of XOR constraints recovered from the problem clauses (0 if Gauss-Jordan elimination is not used)
+             */
+            std::size_t numXors() const;
+
+            /**
+             * Number of pivots of the Gauss-Jordan elimination during search
+             */
+            std::size_t numXorPivots() const;
+
+            /**
+             * Selects the next decision literal
+             * @return literal of an unassigned variable
+             */
             Literal selectLit();
 
             bool allVariablesAssigned() const;
         };
 
+        /**
+         * @brief Sink for the streaming dimacs parser (see inout::dimacs_sink) that constructs a solver from the header
+         * and adds each clause as soon as it is complete. Only the literals of the current clause are buffered.
+         */
+        class SolverLoader {
+            std::optional<Solver> mSolver;
+            std::vector<Literal> mClause;
+            Proof *mProof;
+            bool mOk = true;
+        public:
+            /**
+             * Ctor
+             * @param proof optional proof passed on to the constructed solver (see Solver::setProof)
+             */
+            explicit SolverLoader(Proof *proof = nullptr);
+
+            /**
+             * Constructs the solver and reserves memory for the declared clauses
+             */
+            void header(std::size_t numVariables, std::size_t numClauses);
+
+            /**
+             * Adds a literal to the current clause
+             */
+            void literal(Literal l);
+
+            /**
+             * Adds the current clause to the solver
+             */
+            void endClause();
+
+            /**
+             * Adds a complete clause to the solver
+             */
+            void clause(std::span<const Literal> literals);
+
+            /**
+             * Whether all clauses were added without conflict
+             */
+            bool ok() const;
+
+            /**
+             * The constructed solver
+             * @throws std::runtime_error if no header has been read
+             */
+            Solver &solver();
+        };
+
     } // namespace sat
 
     #endif //SOLVER_HPP
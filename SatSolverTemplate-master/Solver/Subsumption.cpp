@@ -0,0 +1,162 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <numeric>
+#include <optional>
+
+#include "Subsumption.hpp"
+
+namespace sat {
+
+    std::uint64_t clause_signature(std::span<const Literal> clause) {
+        std::uint64_t signature = 0;
+        for (Literal l : clause) {
+            signature |= std::uint64_t(1) << (var(l).get() % 64);
+        }
+
+        return signature;
+    }
+
+    Subsumption::Subsumption(std::size_t numVariables, bool strengthen) :
+        mWatches(2 * numVariables), mNumOccurrences(2 * numVariables, 0), mMarks(2 * numVariables, 0),
+        mStrengthen(strengthen) {}
+
+    std::size_t Subsumption::add(std::span<const Literal> clause, bool removable) {
+        const std::size_t index = mSizes.size();
+        mBegin.push_back(mLiterals.size());
+        mLiterals.insert(mLiterals.end(), clause.begin(), clause.end());
+        mSizes.push_back(static_cast<std::uint32_t>(clause.size()));
+        mSignatures.push_back(clause_signature(clause));
+        mRemovable.push_back(removable);
+        mSubsumed.push_back(false);
+        mStrengthenedBy.push_back(None);
+        for (Literal l : clause) {
+            ++mNumOccurrences[l.get()];
+        }
+
+        return index;
+    }
+
+    std::span<Literal> Subsumption::literals(std::size_t index) {
+        return std::span(mLiterals).subspan(mBegin[index], mSizes[index]);
+    }
+
+    bool Subsumption::check(std::size_t index) {
+        const auto lits = literals(index);
+        ++mStamp;
+        for (Literal l : lits) {
+            mMarks[l.get()] = mStamp;
+        }
+
+        const std::uint64_t signature = mSignatures[index];
+        std::size_t strengthener = None;
+        std::optional<Literal> removed;
+        for (Literal l : lits) {
+            // A subsuming clause is watched by a literal of the clause, a strengthening clause possibly by a negation
+            for (Literal watched : {l, l.negate()}) {
+                for (std::uint32_t other : mWatches[watched.get()]) {
+                    if ((mSignatures[other] & ~signature) != 0) {
+                        continue;
+                    }
+
+                    std::optional<Literal> flipped;
+                    const bool candidate = std::ranges::all_of(literals(other), [this, &flipped](Literal d) {
+                        if (mMarks[d.get()] == mStamp) {
+                            return true;
+                        }
+
+                        if (!flipped && mMarks[d.negate().get()] == mStamp) {
+                            flipped = d;
+                            return true;
+                        }
+
+                        return false;
+                    });
+
+                    if (!candidate) {
+                        continue;
+                    }
+
+                    if (!flipped) {
+                        return false;
+                    }
+
+                    if (mStrengthen && strengthener == None) {
+                        strengthener = other;
+                        removed = flipped->negate();
+                    }
+                }
+            }
+        }
+
+        if (strengthener != None) {
+            auto pos = std::ranges::find(lits, *removed);
+            std::swap(*pos, lits.back());
+            --mSizes[index];
+            mSignatures[index] = clause_signature(literals(index));
+            mStrengthenedBy[index] = strengthener;
+            ++mNumStrengthened;
+        }
+
+        return true;
+    }
+
+    void Subsumption::run() {
+        mOrder.resize(mSizes.size());
+        std::iota(mOrder.begin(), mOrder.end(), 0);
+        std::ranges::stable_sort(mOrder, {}, [this](std::uint32_t index) {
+            return std::pair(mSizes[index], static_cast<bool>(mRemovable[index]));
+        });
+
+        for (std::uint32_t index : mOrder) {
+            if (mRemovable[index] && !check(index)) {
+                mSubsumed[index] = true;
+                ++mNumSubsumed;
+                continue;
+            }
+
+            const auto lits = literals(index);
+            if (lits.empty()) {
+                continue;
+            }
+
+            const Literal watch = *std::ranges::min_element(lits, {}, [this](Literal l) {
+                return mNumOccurrences[l.get()];
+            });
+
+            mWatches[watch.get()].push_back(index);
+        }
+    }
+
+    bool Subsumption::subsumed(std::size_t index) const {
+        return mSubsumed[index];
+    }
+
+    std::size_t Subsumption::strengthenedBy(std::size_t index) const {
+        return mStrengthenedBy[index];
+    }
+
+    const std::vector<std::uint32_t> &Subsumption::order() const noexcept {
+        return mOrder;
+    }
+
+    std::span<const Literal> Subsumption::clause(std::size_t index) const {
+        return std::span(mLiterals).subspan(mBegin[index], mSizes[index]);
+    }
+
+    std::size_t Subsumption::size() const noexcept {
+        return mSizes.size();
+    }
+
+    std::size_t Subsumption::numSubsumed() const noexcept {
+        return mNumSubsumed;
+    }
+
+    std::size_t Subsumption::numStrengthened() const noexcept {
+        return mNumStrengthened;
+    }
+}
@@ -0,0 +1,134 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file Subsumption.hpp
+* @brief Contains the removal of subsumed clauses and the strengthening of clauses by self-subsuming resolution
+*/
+
+#ifndef SUBSUMPTION_HPP
+#define SUBSUMPTION_HPP
+
+#include <vector>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+#include "basic_structures.hpp"
+
+namespace sat {
+
+    /**
+     * 64-bit signature of the variables of a clause. If a clause D subsumes or strengthens a clause C, then all bits of
+     * signature(D) are also set in signature(C), so most pairs of clauses are ruled out by a single bitwise operation
+     * @param clause literals of the clause
+     * @return bit x mod 64 is set for every variable x of the clause
+     */
+    std::uint64_t clause_signature(std::span<const Literal> clause);
+
+    /**
+     * @brief Subsumption and self-subsuming resolution on a set of clauses
+     * @details A clause D subsumes a clause C if D ⊆ C, C is then redundant. If D = D' ∪ {¬l} with D' ⊆ C \ {l} and
+     * l ∈ C, resolving C with D yields C \ {l}, which replaces C (self-subsuming resolution or strengthening).
+     *
+     * Clauses are processed by increasing size, so all possible subsumers of a clause are processed before the clause
+     * itself. This makes a single pass sufficient: a new clause is checked against the smaller clauses (forward
+     * subsumption) and a smaller clause removes all larger clauses it subsumes (backward subsumption). Every kept
+     * clause is added to the occurrence list of only one of its literals (one-watch), the one occurring least often,
+     * since any clause it subsumes or strengthens must contain this literal or its negation. Candidates are filtered by
+     * their signatures (see clause_signature) before the literals are compared.
+     *
+     * Each clause is strengthened at most once per run, so every strengthened clause is the resolvent of exactly two
+     * input clauses (see strengthenedBy()).
+     */
+    class Subsumption {
+    public:
+        static constexpr std::size_t None = std::numeric_limits<std::size_t>::max();
+
+    private:
+        std::vector<Literal> mLiterals;
+        std::vector<std::size_t> mBegin;
+        std::vector<std::uint32_t> mSizes;
+        std::vector<std::uint64_t> mSignatures;
+        std::vector<bool> mRemovable;
+        std::vector<bool> mSubsumed;
+        std::vector<std::size_t> mStrengthenedBy;
+        std::vector<std::vector<std::uint32_t>> mWatches; // One-watch occurrence lists per literal
+        std::vector<std::uint32_t> mNumOccurrences;        // Occurrences of each literal in all added clauses
+        std::vector<std::uint32_t> mOrder;                 // Clauses in the order they are processed
+        std::vector<std::uint64_t> mMarks;                 // Per literal marks of the clause being checked
+        std::uint64_t mStamp = 0;
+        std::size_t mNumSubsumed = 0;
+        std::size_t mNumStrengthened = 0;
+        bool mStrengthen;
+
+        std::span<Literal> literals(std::size_t index);
+
+        /**
+         * Checks a clause against all kept clauses that share a watched variable with it and removes or strengthens it
+         * @return false if the clause is subsumed
+         */
+        bool check(std::size_t index);
+
+    public:
+        /**
+         * Ctor
+         * @param numVariables number of variables of the clauses
+         * @param strengthen whether self-subsuming resolution is performed. If false, clauses are only removed
+         */
+        explicit Subsumption(std::size_t numVariables, bool strengthen = true);
+
+        /**
+         * Adds a clause
+         * @param clause literals of the clause, free of duplicates and tautologies
+         * @param removable whether the clause may be removed or strengthened. Other clauses are only used to subsume
+         * or strengthen removable clauses. Of two equal clauses, the one that is not removable is kept
+         * @return index of the clause
+         */
+        std::size_t add(std::span<const Literal> clause, bool removable = true);
+
+        /**
+         * Removes subsumed clauses and strengthens clauses. Can only be called once
+         */
+        void run();
+
+        /**
+         * Whether a clause has been removed because it is subsumed by another clause
+         */
+        bool subsumed(std::size_t index) const;
+
+        /**
+         * Index of the clause that has been resolved with the given clause to strengthen it, None if the clause has not
+         * been strengthened
+         */
+        std::size_t strengthenedBy(std::size_t index) const;
+
+        /**
+         * Indices of all clauses in the order run() processed them. Subsuming and strengthening clauses come before
+         * the clauses they subsume or strengthen
+         */
+        const std::vector<std::uint32_t> &order() const noexcept;
+
+        /**
+         * Current literals of a clause. Strengthened clauses lack the removed literal
+         */
+        std::span<const Literal> clause(std::size_t index) const;
+
+        /**
+         * Number of added clauses
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * Number of clauses removed by run()
+         */
+        std::size_t numSubsumed() const noexcept;
+
+        /**
+         * Number of clauses strengthened by run()
+         */
+        std::size_t numStrengthened() const noexcept;
+    };
+}
+
+#endif //SUBSUMPTION_HPP
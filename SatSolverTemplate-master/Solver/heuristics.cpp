@@ -4,6 +4,7 @@
 * @brief
 */
 
+#include <algorithm>
 #include <Iterators.hpp>
 
 #include "heuristics.hpp"
@@ -33,7 +34,7 @@ namespace sat {
         return nullptr != impl;
     }
 
-    Variable RandomVariable::operator()(const std::vector<TruthValue>& model, std::size_t seed) const {
+    Variable RandomVariable::operator()(const std::vector<TruthValue>& model, std::size_t numOpenVariables) const {
         std::vector<Variable> unassigned;
         for (auto [varId, val]: iterators::enumerate(model, 0u)) {
             if (val == TruthValue::Undefined) {
@@ -46,8 +47,149 @@ namespace sat {
         }
         
         // Set seed and get random variable from unassigned list
-        RNG::get().setSeed(seed);
+        RNG::get().setSeed(this->seed + static_cast<unsigned>(numOpenVariables));
         size_t idx = RNG::get().random_int<size_t>(0, unassigned.size() - 1);
         return unassigned[idx];
     }
+
+    VSIDS::VSIDS(std::size_t numVariables, double decay) : mHeap(numVariables, 0.0), mDecay(decay) {
+        for (unsigned varId = 0; varId < numVariables; ++varId) {
+            mHeap.push(varId);
+        }
+    }
+
+    Variable VSIDS::operator()(const std::vector<TruthValue> &model, std::size_t) {
+        while (!mHeap.empty()) {
+            const unsigned varId = mHeap.pop();
+            if (model[varId] == TruthValue::Undefined) {
+                return Variable(varId);
+            }
+        }
+
+        throw std::runtime_error("No unassigned variable");
+    }
+
+    void VSIDS::bump(Variable x) {
+        static constexpr double Limit = 1e100;
+        const unsigned varId = x.get();
+        double newActivity = mHeap.key(varId) + mIncrement;
+        if (newActivity > Limit) {
+            // Rescale everything to avoid overflows. This does not change the order of the variables
+            mHeap.scale(1 / Limit);
+            mIncrement /= Limit;
+            newActivity = mHeap.key(varId) + mIncrement;
+        }
+
+        mHeap.increase(varId, newActivity);
+    }
+
+    void VSIDS::decay() {
+        mIncrement /= mDecay;
+    }
+
+    void VSIDS::reinsert(Variable x) {
+        mHeap.push(x.get());
+    }
+
+    double VSIDS::activity(Variable x) const {
+        return mHeap.key(x.get());
+    }
+
+    Phases::Phases(std::size_t numVariables) : mSaved(numVariables, TruthValue::True),
+                                               mTarget(numVariables, TruthValue::Undefined),
+                                               mBest(numVariables, TruthValue::Undefined) {}
+
+    Literal Phases::decide(Variable x) const {
+        TruthValue phase = mUseTarget ? mTarget[x.get()] : TruthValue::Undefined;
+        if (phase == TruthValue::Undefined) {
+            phase = mSaved[x.get()];
+        }
+
+        return phase == TruthValue::False ? neg(x) : pos(x);
+    }
+
+    void Phases::save(Literal l) {
+        mSaved[var(l).get()] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+    }
+
+    void Phases::update(std::span<const Literal> trail) {
+        auto record = [trail](std::vector<TruthValue> &phases) {
+            for (Literal l : trail) {
+                phases[var(l).get()] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+            }
+        };
+
+        if (trail.size() > mTargetSize) {
+            mTargetSize = trail.size();
+            record(mTarget);
+        }
+
+        if (trail.size() > mBestSize) {
+            mBestSize = trail.size();
+            record(mBest);
+        }
+    }
+
+    void Phases::resetTarget() {
+        mTargetSize = 0;
+    }
+
+    bool Phases::shouldRephase(std::size_t conflicts) const {
+        return conflicts >= mNextRephase;
+    }
+
+    Rephase Phases::rephase(std::size_t conflicts) {
+        const Rephase kind = Schedule[mNumRephases % Schedule.size()];
+        ++mNumRephases;
+        mNextRephase = conflicts + RephaseInterval * mNumRephases;
+        switch (kind) {
+            case Rephase::Original:
+                setAll(Polarity::Positive);
+                break;
+            case Rephase::Inverted:
+                setAll(Polarity::Negative);
+                break;
+            case Rephase::Best:
+                for (std::size_t i = 0; i < mSaved.size(); ++i) {
+                    if (mBest[i] != TruthValue::Undefined) {
+                        mSaved[i] = mBest[i];
+                    }
+                }
+
+                mBestSize = 0;
+                break;
+            case Rephase::Random:
+                setAll(Polarity::Random);
+                break;
+        }
+
+        // The target phase would override the new phases
+        std::ranges::fill(mTarget, TruthValue::Undefined);
+        mTargetSize = 0;
+        return kind;
+    }
+
+    void Phases::useTarget(bool enable) {
+        mUseTarget = enable;
+    }
+
+    void Phases::setAll(Polarity polarity) {
+        switch (polarity) {
+            case Polarity::Positive:
+                std::ranges::fill(mSaved, TruthValue::True);
+                break;
+            case Polarity::Negative:
+                std::ranges::fill(mSaved, TruthValue::False);
+                break;
+            case Polarity::Random:
+                for (auto &phase : mSaved) {
+                    phase = RNG::get().random_int(0, 1) ? TruthValue::True : TruthValue::False;
+                }
+                break;
+        }
+    }
+
+    void Phases::setPhase(Variable x, TruthValue phase) {
+        mSaved[x.get()] = phase;
+    }
 }
@@ -10,9 +10,13 @@
 
 #include <vector>
 #include <memory>
+#include <array>
+#include <span>
 
 #include "basic_structures.hpp"
 #include "util/concepts.hpp"
+#include "util/enum.hpp"
+#include "util/IndexedHeap.hpp"
 
 namespace sat {
     /**
@@ -35,9 +39,162 @@ namespace sat {
      *        picks one unassigned variable at random.
      */
     struct RandomVariable {
+        unsigned seed = 0; ///< offset of the random seed, different seeds lead to different choices
+
         Variable operator()(const std::vector<TruthValue> &model, std::size_t numOpenVariables) const;
     };
 
+    /**
+     * @brief Exponential variable state independent decaying sum (EVSIDS) heuristic
+     * @details Every variable has an activity. Variables involved in conflicts are bumped by the current increment,
+     * and instead of decaying all activities after each conflict, the increment grows geometrically. The unassigned
+     * variable with the highest activity is selected using an indexed max-heap, so a decision costs O(log n).
+     * Variables are removed from the heap lazily when popped and must be reinserted when they are unassigned.
+     * @note This class models the heuristic concept, but the solver needs to notify it about conflicts and
+     * unassignments, so it is not meant to be hidden inside the Heuristic wrapper.
+     */
+    class VSIDS {
+        IndexedMaxHeap<double> mHeap;
+        double mIncrement = 1;
+        double mDecay;
+    public:
+        /**
+         * Ctor. All variables start with activity 0 and are contained in the heap
+         * @param numVariables number of variables
+         * @param decay activity decay factor in (0, 1). Smaller values focus more on recent conflicts
+         */
+        explicit VSIDS(std::size_t numVariables, double decay = 0.95);
+
+        /**
+         * Selects the unassigned variable with the highest activity
+         * @param model current assignment
+         * @return unassigned variable
+         * @throws std::runtime_error if there is no unassigned variable
+         */
+        Variable operator()(const std::vector<TruthValue> &model, std::size_t);
+
+        /**
+         * Increases the activity of a variable by the current increment
+         * @param x variable involved in a conflict
+         */
+        void bump(Variable x);
+
+        /**
+         * Decays all activities (by increasing the increment). Call once per conflict
+         */
+        void decay();
+
+        /**
+         * Makes an unassigned variable selectable again
+         * @param x the variable that was unassigned
+         */
+        void reinsert(Variable x);
+
+        /**
+         * Current activity of a variable
+         */
+        double activity(Variable x) const;
+    };
+
+    /**
+     * @brief Kinds of rephasing, i.e. ways of resetting the saved phases
+     * @details
+     * - Original: all variables positive (the initial phase)
+     * - Inverted: all variables negative
+     * - Best: the assignment of the largest conflict free trail since the last best rephase
+     * - Random: random phases
+     */
+    PENUM(Rephase, Original, Inverted, Best, Random)
+
+    /**
+     * @brief Uniform polarities of all variables (positive, negative or random)
+     */
+    PENUM(Polarity, Positive, Negative, Random)
+
+    /**
+     * @brief Polarity selection for decisions
+     * @details Implements phase saving: when a variable is unassigned, its value is remembered and reused the next time
+     * it is decided. In addition, the target phase records the assignment of the largest conflict free trail since the
+     * last restart and takes precedence over the saved phase. The best phase records the largest conflict free trail
+     * since the last best rephase. Periodically, the saved phases are reset (rephased) following the schedule
+     * Original, Best, Inverted, Best, Random, Best, ...
+     */
+    class Phases {
+        std::vector<TruthValue> mSaved;
+        std::vector<TruthValue> mTarget;
+        std::vector<TruthValue> mBest;
+        std::size_t mTargetSize = 0;
+        std::size_t mBestSize = 0;
+        std::size_t mNumRephases = 0;
+        std::size_t mNextRephase = RephaseInterval;
+        bool mUseTarget = true;
+    public:
+        static constexpr std::size_t RephaseInterval = 1000;
+        static constexpr std::array Schedule{Rephase::Original, Rephase::Best, Rephase::Inverted, Rephase::Best,
+                                             Rephase::Random, Rephase::Best};
+
+        /**
+         * Ctor. All phases are initially positive
+         * @param numVariables number of variables
+         */
+        explicit Phases(std::size_t numVariables);
+
+        /**
+         * Decision literal for the given variable
+         * @param x variable to decide
+         * @return literal of x with the target phase if available, otherwise with the saved phase
+         */
+        Literal decide(Variable x) const;
+
+        /**
+         * Saves the phase of a literal that is about to be unassigned
+         * @param l the assigned literal
+         */
+        void save(Literal l);
+
+        /**
+         * Updates target and best phases if the given conflict free trail is larger than the recorded ones
+         * @param trail fully propagated, conflict free assignment
+         */
+        void update(std::span<const Literal> trail);
+
+        /**
+         * Resets the target phase. Should be called on restarts
+         */
+        void resetTarget();
+
+        /**
+         * Whether the schedule demands a rephase
+         * @param conflicts current number of conflicts
+         */
+        bool shouldRephase(std::size_t conflicts) const;
+
+        /**
+         * Resets the saved phases according to the next entry of the schedule
+         * @param conflicts current number of conflicts
+         * @return the kind of rephasing performed
+         */
+        Rephase rephase(std::size_t conflicts);
+
+        /**
+         * Enables or disables target phases
+         */
+        void useTarget(bool enable);
+
+        /**
+         * Sets the saved phases of all variables
+         * @param polarity the new phases
+         */
+        void setAll(Polarity polarity);
+
+        /**
+         * Sets the saved phase of a variable
+         * @param x the variable
+         * @param phase TruthValue::True or TruthValue::False
+         */
+        void setPhase(Variable x, TruthValue phase);
+    };
+
     namespace detail {
         /**
          * @brief This is a helper class for the implementation of a type erasure heuristic wrapper
@@ -91,6 +91,40 @@ namespace sat::inout {
 
         return {std::move(ret), numVars};
     }
+
+    std::size_t DimacsProblem::numClauses() const noexcept {
+        return clauseEnds.size();
+    }
+
+    std::span<const Literal> DimacsProblem::clause(std::size_t index) const noexcept {
+        const std::size_t begin = index == 0 ? 0 : clauseEnds[index - 1];
+        return std::span(literals).subspan(begin, clauseEnds[index] - begin);
+    }
+
+    void DimacsProblem::header(std::size_t numVars, std::size_t numClauses) {
+        numVariables = numVars;
+        clauseEnds.reserve(numClauses);
+    }
+
+    void DimacsProblem::literal(Literal l) {
+        literals.push_back(l);
+    }
+
+    void DimacsProblem::endClause() {
+        clauseEnds.push_back(literals.size());
+    }
+
+    DimacsProblem parse_dimacs(std::string_view text) {
+        DimacsProblem problem;
+        parse_dimacs(text, problem);
+        return problem;
+    }
+
+    DimacsProblem read_dimacs_file(const std::string &path) {
+        DimacsProblem problem;
+        read_dimacs_file(path, problem);
+        return problem;
+    }
 }
 
 namespace sat {
@@ -13,10 +13,110 @@
 #include <vector>
 #include <iterator>
 #include <sstream>
+#include <span>
+#include <string_view>
+#include <string>
+#include <limits>
+#include <cstdlib>
+#include <stdexcept>
 
 #include "basic_structures.hpp"
 #include "Clause.hpp"
 #include "util/concepts.hpp"
+#include "util/MappedFile.hpp"
+#include "util/Decompression.hpp"
+
+namespace sat::detail {
+    /**
+     * @brief Hand written tokenizer for the dimacs format that works directly on the file contents
+     */
+    class DimacsScanner {
+        const char *mPos;
+        const char *mEnd;
+
+        static bool isSpace(char c) noexcept {
+            return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+        }
+
+        static bool isDigit(char c) noexcept {
+            return c >= '0' && c <= '9';
+        }
+
+    public:
+        explicit DimacsScanner(std::string_view text) noexcept : mPos(text.data()), mEnd(text.data() + text.size()) {}
+
+        /**
+         * Skips whitespace
+         * @return false if the end of the text is reached
+         */
+        bool skipWhitespace() noexcept {
+            while (mPos != mEnd && isSpace(*mPos)) {
+                ++mPos;
+            }
+
+            return mPos != mEnd;
+        }
+
+        void skipLine() noexcept {
+            while (mPos != mEnd && *mPos != '\n') {
+                ++mPos;
+            }
+        }
+
+        char peek() const noexcept {
+            return *mPos;
+        }
+
+        bool startsInteger() const noexcept {
+            return isDigit(*mPos) || *mPos == '-' || *mPos == '+';
+        }
+
+        /**
+         * Reads the given word followed by whitespace
+         */
+        void expect(std::string_view word) {
+            if (static_cast<std::size_t>(mEnd - mPos) < word.size() || std::string_view(mPos, word.size()) != word) {
+                throw std::runtime_error("invalid format");
+            }
+
+            mPos += word.size();
+            if (mPos != mEnd && !isSpace(*mPos)) {
+                throw std::runtime_error("invalid format");
+            }
+        }
+
+        /**
+         * Reads a signed integer. Leading whitespace is skipped
+         * @param max largest accepted absolute value (at most std::numeric_limits<long long>::max() / 10)
+         */
+        long long readInt(long long max = std::numeric_limits<int>::max()) {
+            skipWhitespace();
+            bool negative = false;
+            if (mPos != mEnd && (*mPos == '-' || *mPos == '+')) {
+                negative = *mPos == '-';
+                ++mPos;
+            }
+
+            if (mPos == mEnd || !isDigit(*mPos)) {
+                throw std::runtime_error("invalid format");
+            }
+
+            long long value = 0;
+            for (; mPos != mEnd && isDigit(*mPos); ++mPos) {
+                value = value * 10 + (*mPos - '0');
+                if (value > max) {
+                    throw std::runtime_error("integer out of range");
+                }
+            }
+
+            if (mPos != mEnd && !isSpace(*mPos)) {
+                throw std::runtime_error("invalid format");
+            }
+
+            return negative ? -value : value;
+        }
+    };
+}
 
 
 /**
@@ -45,6 +145,218 @@ namespace sat::inout {
      */
     auto read_from_dimacs(std::istream &in) -> std::pair<std::vector<std::vector<Literal>>, std::size_t>;
 
+    /**
+     * Concept for consumers of a streaming dimacs parser. The parser calls header() once with the counts declared in
+     * the header, then literal() for each literal and endClause() after the last literal of each clause
+     */
+    template<typename S>
+    concept dimacs_sink = requires(S &sink, std::size_t n, Literal l) {
+        sink.header(n, n);
+        sink.literal(l);
+        sink.endClause();
+    };
+
+    /**
+     * @brief SAT problem whose clauses are stored one after the other in a single buffer
+     */
+    struct DimacsProblem {
+        std::size_t numVariables = 0; ///< number of variables declared in the header
+        std::vector<Literal> literals; ///< literals of all clauses
+        std::vector<std::size_t> clauseEnds; ///< end offset of each clause in literals
+
+        /**
+         * Number of clauses
+         */
+        std::size_t numClauses() const noexcept;
+
+        /**
+         * Literals of a clause
+         * @param index index of the clause
+         * @return view on the literals of the clause
+         */
+        std::span<const Literal> clause(std::size_t index) const noexcept;
+
+        /**
+         * View on all clauses
+         */
+        auto clauses() const {
+            return std::views::iota(std::size_t(0), numClauses()) |
+                   std::views::transform([this](std::size_t i) { return clause(i); });
+        }
+
+        /**
+         * @name dimacs_sink interface
+         * @{
+         */
+        void header(std::size_t numVars, std::size_t numClauses);
+
+        void literal(Literal l);
+
+        void endClause();
+        /** @} */
+    };
+
+    /**
+     * @brief Incremental dimacs parser that streams the problem into a sink.
+     * @details The text can be fed in arbitrary pieces. Complete lines are parsed in place, only a line that is split
+     * between two pieces is copied. Clauses may span multiple lines or share a line. Comment lines are skipped and
+     * parsing stops at a line starting with '%'.
+     * @tparam S sink type
+     */
+    template<dimacs_sink S>
+    class DimacsParser {
+        S &mSink;
+        std::string mCarry;
+        std::size_t mNumVariables = 0;
+        bool mHeader = false;
+        bool mOpenClause = false;
+        bool mDone = false;
+
+        void parseLines(std::string_view text) {
+            detail::DimacsScanner scanner(text);
+            while (!mDone && scanner.skipWhitespace()) {
+                const char c = scanner.peek();
+                if (c == 'c') {
+                    scanner.skipLine();
+                } else if (c == '%') {
+                    mDone = true;
+                } else if (c == 'p' && !mHeader) {
+                    scanner.expect("p");
+                    scanner.skipWhitespace();
+                    scanner.expect("cnf");
+                    const auto numVars = scanner.readInt();
+                    const auto numClauses = scanner.readInt();
+                    if (numVars < 0 || numClauses < 0) {
+                        throw std::runtime_error("invalid format");
+                    }
+
+                    mNumVariables = static_cast<std::size_t>(numVars);
+                    mSink.header(mNumVariables, static_cast<std::size_t>(numClauses));
+                    mHeader = true;
+                } else if (mHeader && scanner.startsInteger()) {
+                    const auto val = scanner.readInt();
+                    if (val == 0) {
+                        mSink.endClause();
+                        mOpenClause = false;
+                    } else if (static_cast<std::size_t>(std::abs(val)) > mNumVariables) {
+                        throw std::runtime_error("literal " + std::to_string(val) + " of undeclared variable");
+                    } else {
+                        mSink.literal(from_dimacs(static_cast<int>(val)));
+                        mOpenClause = true;
+                    }
+                } else {
+                    throw std::runtime_error("invalid format");
+                }
+            }
+        }
+
+    public:
+        /**
+         * Ctor
+         * @param sink receives the header and the clauses in the order of the text
+         */
+        explicit DimacsParser(S &sink) : mSink(sink) {}
+
+        /**
+         * Parses the next piece of text. The last (incomplete) line is kept until the next call
+         * @param text piece of a dimacs file
+         * @throws std::runtime_error if the text is not in dimacs format or contains literals of undeclared variables
+         */
+        void feed(std::string_view text) {
+            if (!mCarry.empty()) {
+                const auto lineEnd = text.find('\n');
+                if (lineEnd == std::string_view::npos) {
+                    mCarry.append(text);
+                    return;
+                }
+
+                mCarry.append(text.substr(0, lineEnd + 1));
+                parseLines(mCarry);
+                mCarry.clear();
+                text.remove_prefix(lineEnd + 1);
+            }
+
+            const auto lastLineEnd = text.rfind('\n');
+            if (lastLineEnd == std::string_view::npos) {
+                mCarry.assign(text);
+                return;
+            }
+
+            parseLines(text.substr(0, lastLineEnd + 1));
+            mCarry.assign(text.substr(lastLineEnd + 1));
+        }
+
+        /**
+         * Parses the remaining text. The terminating 0 of the last clause may be missing
+         * @throws std::runtime_error if the text is not in dimacs format or contains literals of undeclared variables
+         */
+        void finish() {
+            parseLines(mCarry);
+            mCarry.clear();
+            if (mOpenClause) {
+                mSink.endClause();
+                mOpenClause = false;
+            }
+        }
+    };
+
+    /**
+     * Parses a SAT problem in dimacs format and streams it into a sink (see DimacsParser)
+     * @tparam S sink type
+     * @param text contents of a dimacs file
+     * @param sink receives the header and the clauses in the order of the text
+     * @throws std::runtime_error if the text is not in dimacs format or contains literals of undeclared variables
+     */
+    template<dimacs_sink S>
+    void parse_dimacs(std::string_view text, S &sink) {
+        DimacsParser parser(sink);
+        parser.feed(text);
+        parser.finish();
+    }
+
+    /**
+     * Reads a SAT problem in dimacs format from a file and streams it into a sink. Plain files are memory mapped and
+     * parsed in place. Files compressed with gzip, xz or bzip2 are detected automatically and decompressed in a
+     * background thread while parsing
+     * @tparam S sink type
+     * @param path path to the file
+     * @param sink receives the header and the clauses in the order of the file
+     * @throws std::runtime_error if the file cannot be read or is not in dimacs format
+     */
+    template<dimacs_sink S>
+    void read_dimacs_file(const std::string &path, S &sink) {
+        MappedFile file(path);
+        const Compression compression = detect_compression(file.view());
+        if (compression == Compression::None) {
+            parse_dimacs(file.view(), sink);
+            return;
+        }
+
+        DimacsParser parser(sink);
+        DecompressingReader reader(std::move(file), compression);
+        while (auto chunk = reader.next()) {
+            parser.feed(*chunk);
+        }
+
+        parser.finish();
+    }
+
+    /**
+     * Parses a SAT problem in dimacs format (see DimacsParser)
+     * @param text contents of a dimacs file
+     * @return the parsed problem
+     * @throws std::runtime_error if the text is not in dimacs format or contains literals of undeclared variables
+     */
+    DimacsProblem parse_dimacs(std::string_view text);
+
+    /**
+     * Reads a SAT problem in dimacs format from a file (see read_dimacs_file(const std::string &, S &))
+     * @param path path to the file
+     * @return the parsed problem
+     * @throws std::runtime_error if the file cannot be read or is not in dimacs format
+     */
+    DimacsProblem read_dimacs_file(const std::string &path);
+
     /**
      * Converts a range of clauses to dimacs format
      * @tparam R clause range type
@@ -0,0 +1,123 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <charconv>
+#include <cstdlib>
+#include <algorithm>
+
+#include "proof.hpp"
+#include "inout.hpp"
+
+namespace sat {
+
+    Proof::Proof(const std::string &path, ProofFormat format, std::size_t bufferSize) :
+        mOut(path, bufferSize), mFormat(format) {}
+
+    bool Proof::binary() const {
+        return mFormat == ProofFormat::BinaryDrat || mFormat == ProofFormat::BinaryLrat;
+    }
+
+    void Proof::writeNumber(std::int64_t number) {
+        if (binary()) {
+            auto mapped = 2 * static_cast<std::uint64_t>(std::abs(number)) + (number < 0);
+            // 7 bits per byte, least significant group first, the high bit marks continuation
+            while (mapped > 0x7f) {
+                mLine.push_back(static_cast<char>((mapped & 0x7f) | 0x80));
+                mapped >>= 7;
+            }
+
+            mLine.push_back(static_cast<char>(mapped));
+        } else {
+            char buffer[24];
+            const auto res = std::to_chars(buffer, buffer + sizeof(buffer), number);
+            mLine.append(buffer, res.ptr);
+            mLine.push_back(' ');
+        }
+    }
+
+    void Proof::writeLiterals(std::span<const Literal> clause) {
+        for (Literal l : clause) {
+            writeNumber(inout::to_dimacs(l));
+        }
+
+        writeNumber(0);
+    }
+
+    void Proof::add(std::uint64_t id, std::span<const Literal> clause, std::span<const std::uint64_t> hints) {
+        ++mNumAdded;
+        mLastId = std::max(mLastId, id);
+        mLine.clear();
+        if (binary()) {
+            mLine.push_back('a');
+        }
+
+        if (lrat()) {
+            writeNumber(static_cast<std::int64_t>(id));
+        }
+
+        writeLiterals(clause);
+        if (lrat()) {
+            for (auto hint : hints) {
+                writeNumber(static_cast<std::int64_t>(hint));
+            }
+
+            writeNumber(0);
+        }
+
+        if (!binary()) {
+            mLine.back() = '\n';
+        }
+
+        mOut.write(mLine);
+    }
+
+    void Proof::remove(std::uint64_t id, std::span<const Literal> clause) {
+        ++mNumDeleted;
+        mLine.clear();
+        if (binary()) {
+            mLine.push_back('d');
+        } else if (lrat()) {
+            // Textual LRAT deletions are introduced by the id of the latest added clause
+            writeNumber(static_cast<std::int64_t>(mLastId));
+            mLine.append("d ");
+        } else {
+            mLine.append("d ");
+        }
+
+        if (lrat()) {
+            writeNumber(static_cast<std::int64_t>(id));
+            writeNumber(0);
+        } else {
+            writeLiterals(clause);
+        }
+
+        if (!binary()) {
+            mLine.back() = '\n';
+        }
+
+        mOut.write(mLine);
+    }
+
+    bool Proof::lrat() const {
+        return mFormat == ProofFormat::Lrat || mFormat == ProofFormat::BinaryLrat;
+    }
+
+    void Proof::close() {
+        mOut.close();
+    }
+
+    ProofFormat Proof::format() const {
+        return mFormat;
+    }
+
+    std::size_t Proof::numAdded() const {
+        return mNumAdded;
+    }
+
+    std::size_t Proof::numDeleted() const {
+        return mNumDeleted;
+    }
+}
@@ -0,0 +1,109 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file proof.hpp
+* @brief Contains the logging of unsatisfiability proofs
+*/
+
+#ifndef PROOF_HPP
+#define PROOF_HPP
+
+#include <span>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "basic_structures.hpp"
+#include "util/enum.hpp"
+#include "util/AsyncWriter.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Supported proof formats
+     * @details
+     * - Drat: textual DRAT, one clause per line in dimacs notation, deletions are prefixed by "d"
+     * - BinaryDrat: binary DRAT, each clause is introduced by 'a' or 'd' followed by the variable-length encoded
+     *   literals and a terminating 0
+     * - Lrat: textual LRAT. Each added clause is preceded by its id and followed by the ids of the clauses that
+     *   imply it by unit propagation (hints). Deletions list clause ids only
+     * - BinaryLrat: binary LRAT, ids, literals and hints are variable-length encoded like binary DRAT literals
+     */
+    PENUM(ProofFormat, Drat, BinaryDrat, Lrat, BinaryLrat)
+
+    /**
+     * @brief Writes a DRAT or LRAT proof of unsatisfiability.
+     * @details The solver reports every learned clause and every deleted learned clause. If the formula is
+     * unsatisfiable, the proof ends with the empty clause. Clauses are identified by ids: the problem clauses are
+     * numbered from 1 in the order they are added, derived clauses receive the subsequent ids. Output is written by a
+     * background thread (see AsyncWriter).
+     */
+    class Proof {
+        AsyncWriter mOut;
+        ProofFormat mFormat;
+        std::string mLine;
+        std::uint64_t mLastId = 0;
+        std::size_t mNumAdded = 0;
+        std::size_t mNumDeleted = 0;
+
+        bool binary() const;
+
+        void writeNumber(std::int64_t number);
+
+        void writeLiterals(std::span<const Literal> clause);
+
+    public:
+        /**
+         * Ctor
+         * @param path path of the proof file
+         * @param format proof format
+         * @param bufferSize size of the output ring buffer in bytes
+         * @throws std::runtime_error if the file cannot be opened
+         */
+        Proof(const std::string &path, ProofFormat format, std::size_t bufferSize = AsyncWriter::DefaultCapacity);
+
+        /**
+         * Logs the addition of a clause that is implied by the formula (reverse unit propagation)
+         * @param id id of the new clause
+         * @param clause the new clause
+         * @param hints ids of the clauses that become unit one after the other when the literals of the new clause
+         * are falsified, the last one must be falsified. Only used by LRAT
+         */
+        void add(std::uint64_t id, std::span<const Literal> clause, std::span<const std::uint64_t> hints = {});
+
+        /**
+         * Logs the deletion of a clause
+         * @param id id of the deleted clause
+         * @param clause the deleted clause
+         */
+        void remove(std::uint64_t id, std::span<const Literal> clause);
+
+        /**
+         * Whether the proof requires hints (LRAT)
+         */
+        bool lrat() const;
+
+        /**
+         * Writes all pending output and closes the proof file
+         * @throws std::runtime_error if the proof could not be written completely
+         */
+        void close();
+
+        /**
+         * The proof format
+         */
+        ProofFormat format() const;
+
+        /**
+         * Number of added clauses so far
+         */
+        std::size_t numAdded() const;
+
+        /**
+         * Number of deleted clauses so far
+         */
+        std::size_t numDeleted() const;
+    };
+}
+
+#endif //PROOF_HPP
@@ -0,0 +1,89 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+
+#include <cmath>
+
+#include "restarts.hpp"
+
+namespace sat {
+
+    double luby(double base, unsigned index) {
+        // Find the finite subsequence that contains index, and the size of that subsequence
+        unsigned size = 1;
+        unsigned seq = 0;
+        while (size < index + 1) {
+            ++seq;
+            size = 2 * size + 1;
+        }
+
+        while (size - 1 != index) {
+            size = (size - 1) / 2;
+            --seq;
+            index = index % size;
+        }
+
+        return std::pow(base, seq);
+    }
+
+    ExponentialMovingAverage::ExponentialMovingAverage(double alpha) : mAlpha(alpha) {}
+
+    void ExponentialMovingAverage::update(double sample) {
+        mBiased += mAlpha * (sample - mBiased);
+        mBeta *= 1 - mAlpha;
+        mValue = mBeta < 1 ? mBiased / (1 - mBeta) : sample;
+    }
+
+    double ExponentialMovingAverage::value() const {
+        return mValue;
+    }
+
+    Restarts::Restarts(RestartPolicy policy) : mPolicy(policy), mFastLbd(1.0 / 32), mSlowLbd(1e-4),
+                                               mTrailSize(1.0 / 5000) {
+        mLimit = static_cast<std::size_t>(LubyUnit * luby(2, 0));
+    }
+
+    void Restarts::onConflict(unsigned lbd, std::size_t trailSize) {
+        ++mConflicts;
+        ++mConflictsSinceRestart;
+        if (mPolicy != RestartPolicy::Glucose) {
+            return;
+        }
+
+        mFastLbd.update(lbd);
+        mSlowLbd.update(lbd);
+        // Block the restart if the solver assigned considerably more variables than usual
+        if (mConflicts > BlockingWarmup && static_cast<double>(trailSize) > BlockingFactor * mTrailSize.value()) {
+            mConflictsSinceRestart = 0;
+        }
+
+        mTrailSize.update(static_cast<double>(trailSize));
+    }
+
+    bool Restarts::shouldRestart() const {
+        switch (mPolicy) {
+            case RestartPolicy::Luby:
+                return mConflictsSinceRestart >= mLimit;
+            case RestartPolicy::Glucose:
+                return mConflictsSinceRestart >= MinConflicts && mFastLbd.value() > Margin * mSlowLbd.value();
+            default:
+                return false;
+        }
+    }
+
+    void Restarts::restarted() {
+        ++mNumRestarts;
+        mConflictsSinceRestart = 0;
+        mLimit = static_cast<std::size_t>(LubyUnit * luby(2, static_cast<unsigned>(mNumRestarts)));
+    }
+
+    std::size_t Restarts::numRestarts() const {
+        return mNumRestarts;
+    }
+
+    RestartPolicy Restarts::policy() const {
+        return mPolicy;
+    }
+}
@@ -0,0 +1,120 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @file restarts.hpp
+* @brief Contains the restart policies of the solver
+*/
+
+#ifndef RESTARTS_HPP
+#define RESTARTS_HPP
+
+#include <cstddef>
+
+#include "util/enum.hpp"
+
+namespace sat {
+
+    /**
+     * @brief Available restart policies
+     * @details
+     * - None: never restart
+     * - Luby: restart after a number of conflicts following the Luby sequence (1, 1, 2, 1, 1, 2, 4, ...)
+     * - Glucose: restart when the recent learned clauses are of worse quality (higher LBD) than on average
+     */
+    PENUM(RestartPolicy, None, Luby, Glucose)
+
+    /**
+     * Computes the element of the Luby sequence scaled geometrically by a base
+     * @param base growth factor (2 for the original sequence)
+     * @param index 0-based index in the sequence
+     * @return base^k for the k that belongs to the given index
+     */
+    double luby(double base, unsigned index);
+
+    /**
+     * @brief Exponential moving average with bias correction
+     * @details Early averages are corrected for the initial value of 0, so even slow averages are meaningful after
+     * few updates.
+     */
+    class ExponentialMovingAverage {
+        double mBiased = 0;
+        double mValue = 0;
+        double mAlpha;
+        double mBeta = 1;
+    public:
+        /**
+         * Ctor
+         * @param alpha smoothing factor in (0, 1]. Large values favor recent samples
+         */
+        explicit ExponentialMovingAverage(double alpha);
+
+        /**
+         * Adds a sample
+         */
+        void update(double sample);
+
+        /**
+         * Current average
+         */
+        double value() const;
+    };
+
+    /**
+     * @brief Decides when the search should restart.
+     * @details The solver reports each conflict together with the LBD of the learned clause and the size of the trail
+     * at the time of the conflict. The glucose policy compares a fast and a slow moving average of the LBD and
+     * restarts when the fast one exceeds the slow one by a margin. Restarts are blocked when the trail is much larger
+     * than usual as the solver is then likely approaching a model.
+     */
+    class Restarts {
+        RestartPolicy mPolicy;
+        std::size_t mConflicts = 0;
+        std::size_t mConflictsSinceRestart = 0;
+        std::size_t mNumRestarts = 0;
+        std::size_t mLimit = 0;
+        ExponentialMovingAverage mFastLbd;
+        ExponentialMovingAverage mSlowLbd;
+        ExponentialMovingAverage mTrailSize;
+    public:
+        static constexpr unsigned LubyUnit = 100;
+        static constexpr std::size_t MinConflicts = 50;
+        static constexpr double Margin = 1.25;
+        static constexpr double BlockingFactor = 1.4;
+        static constexpr std::size_t BlockingWarmup = 10000;
+
+        /**
+         * Ctor
+         * @param policy restart policy to use
+         */
+        explicit Restarts(RestartPolicy policy = RestartPolicy::Glucose);
+
+        /**
+         * Records a conflict
+         * @param lbd literal block distance of the learned clause
+         * @param trailSize number of assigned literals when the conflict occurred
+         */
+        void onConflict(unsigned lbd, std::size_t trailSize);
+
+        /**
+         * Whether the search should restart now
+         */
+        bool shouldRestart() const;
+
+        /**
+         * Must be called whenever the solver restarts
+         */
+        void restarted();
+
+        /**
+         * Number of restarts so far
+         */
+        std::size_t numRestarts() const;
+
+        /**
+         * The restart policy in use
+         */
+        RestartPolicy policy() const;
+    };
+}
+
+#endif //RESTARTS_HPP
@@ -0,0 +1,130 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "AsyncWriter.hpp"
+
+namespace sat {
+
+    AsyncWriter::AsyncWriter(const std::string &path, std::size_t capacity) :
+        mFile(std::fopen(path.c_str(), "wb")), mPath(path), mBuffer(std::max<std::size_t>(capacity, 1)) {
+        if (mFile == nullptr) {
+            throw std::runtime_error("Cannot open file " + path);
+        }
+
+        mWorker = std::jthread([this] {
+            while (true) {
+                bool closed;
+                {
+                    std::unique_lock lock(mMutex);
+                    mDataAvailable.wait_for(lock, FlushInterval, [this] {
+                        return mClosed || pending() >= mBuffer.size() / 4;
+                    });
+                    closed = mClosed;
+                }
+
+                // All data is in the buffer once the writer is closed, so a single drain suffices
+                drain();
+                if (closed) {
+                    break;
+                }
+            }
+        });
+    }
+
+    AsyncWriter::~AsyncWriter() {
+        shutdown();
+    }
+
+    std::size_t AsyncWriter::pending() const {
+        return mHead.load(std::memory_order_acquire) - mTail.load(std::memory_order_acquire);
+    }
+
+    void AsyncWriter::drain() {
+        const std::size_t head = mHead.load(std::memory_order_acquire);
+        std::size_t tail = mTail.load(std::memory_order_relaxed);
+        while (tail != head) {
+            const std::size_t offset = tail % mBuffer.size();
+            const std::size_t count = std::min(head - tail, mBuffer.size() - offset);
+            if (!mFailed && std::fwrite(mBuffer.data() + offset, 1, count, mFile) != count) {
+                mFailed = true;
+            }
+
+            tail += count;
+        }
+
+        {
+            // Publishing under the lock prevents the writer from missing the notification
+            std::lock_guard lock(mMutex);
+            mTail.store(tail, std::memory_order_release);
+        }
+
+        mSpaceAvailable.notify_one();
+    }
+
+    void AsyncWriter::write(std::string_view data) {
+        if (mClosed) {
+            return;
+        }
+
+        const std::size_t threshold = mBuffer.size() / 4;
+        while (!data.empty()) {
+            const std::size_t head = mHead.load(std::memory_order_relaxed);
+            const std::size_t used = head - mTail.load(std::memory_order_acquire);
+            if (used == mBuffer.size()) {
+                std::unique_lock lock(mMutex);
+                mDataAvailable.notify_one();
+                mSpaceAvailable.wait(lock, [this] { return pending() < mBuffer.size(); });
+                continue;
+            }
+
+            const std::size_t count = std::min(mBuffer.size() - used, data.size());
+            const std::size_t offset = head % mBuffer.size();
+            const std::size_t first = std::min(count, mBuffer.size() - offset);
+            std::memcpy(mBuffer.data() + offset, data.data(), first);
+            std::memcpy(mBuffer.data(), data.data() + first, count - first);
+            mHead.store(head + count, std::memory_order_release);
+            if (used < threshold && used + count >= threshold) {
+                mDataAvailable.notify_one();
+            }
+
+            data.remove_prefix(count);
+        }
+    }
+
+    void AsyncWriter::shutdown() {
+        {
+            std::lock_guard lock(mMutex);
+            if (mClosed) {
+                return;
+            }
+
+            mClosed = true;
+        }
+
+        mDataAvailable.notify_one();
+        mWorker.join();
+        if (std::fclose(mFile) != 0) {
+            mFailed = true;
+        }
+
+        mFile = nullptr;
+    }
+
+    void AsyncWriter::close() {
+        shutdown();
+        if (mFailed) {
+            throw std::runtime_error("Error writing to file " + mPath);
+        }
+    }
+
+    std::size_t AsyncWriter::size() const {
+        return mHead.load(std::memory_order_relaxed);
+    }
+}
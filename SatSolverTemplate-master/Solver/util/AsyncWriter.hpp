@@ -0,0 +1,87 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file AsyncWriter.hpp
+* @brief Contains a file writer that hands the output to a background thread through a ring buffer
+*/
+
+#ifndef ASYNCWRITER_HPP
+#define ASYNCWRITER_HPP
+
+#include <cstdio>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+
+namespace sat {
+    /**
+     * @brief Writes data to a file in a background thread.
+     * @details write() only copies the data into a ring buffer, the background thread drains the buffer to the file
+     * whenever a quarter of it is filled or a short interval has passed. The writing thread only blocks if the buffer
+     * is full. There must only be a single writing thread.
+     */
+    class AsyncWriter {
+        std::FILE *mFile;
+        std::string mPath;
+        std::vector<char> mBuffer;
+        std::atomic<std::size_t> mHead = 0; // total number of bytes written to the buffer
+        std::atomic<std::size_t> mTail = 0; // total number of bytes drained to the file
+        std::mutex mMutex;
+        std::condition_variable mDataAvailable;
+        std::condition_variable mSpaceAvailable;
+        bool mClosed = false;
+        std::atomic<bool> mFailed = false;
+        std::jthread mWorker;
+
+        std::size_t pending() const;
+
+        void drain();
+
+        void shutdown();
+
+    public:
+        static constexpr std::size_t DefaultCapacity = 1 << 24;
+        static constexpr std::chrono::milliseconds FlushInterval{50};
+
+        /**
+         * Ctor. Creates or truncates the file and starts the background thread
+         * @param path path of the output file
+         * @param capacity size of the ring buffer in bytes
+         * @throws std::runtime_error if the file cannot be opened
+         */
+        explicit AsyncWriter(const std::string &path, std::size_t capacity = DefaultCapacity);
+
+        AsyncWriter(const AsyncWriter &) = delete;
+        AsyncWriter &operator=(const AsyncWriter &) = delete;
+
+        /**
+         * Dtor. Writes the remaining data and closes the file. Errors are ignored, call close() to observe them
+         */
+        ~AsyncWriter();
+
+        /**
+         * Appends data to the file. Blocks only while the ring buffer is full
+         * @param data data to append
+         */
+        void write(std::string_view data);
+
+        /**
+         * Writes the remaining data, stops the background thread and closes the file. Subsequent writes are ignored
+         * @throws std::runtime_error if any data could not be written
+         */
+        void close();
+
+        /**
+         * Total number of bytes passed to write()
+         */
+        std::size_t size() const;
+    };
+}
+
+#endif //ASYNCWRITER_HPP
@@ -0,0 +1,91 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @file BoundedQueue.hpp
+* @brief Contains a blocking queue with limited capacity for producer consumer setups
+*/
+
+#ifndef BOUNDEDQUEUE_HPP
+#define BOUNDEDQUEUE_HPP
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <cstddef>
+
+namespace sat {
+    /**
+     * @brief Thread safe FIFO queue with limited capacity.
+     * @details Producers block while the queue is full, consumers block while it is empty. Closing the queue wakes up
+     * everyone: subsequent pushes fail, while consumers still receive the remaining elements.
+     * @tparam T element type
+     */
+    template<typename T>
+    class BoundedQueue {
+        std::mutex mMutex;
+        std::condition_variable mNotFull;
+        std::condition_variable mNotEmpty;
+        std::deque<T> mItems;
+        std::size_t mCapacity;
+        bool mClosed = false;
+
+    public:
+        /**
+         * Ctor
+         * @param capacity maximum number of elements in the queue (at least 1)
+         */
+        explicit BoundedQueue(std::size_t capacity) : mCapacity(capacity > 0 ? capacity : 1) {}
+
+        /**
+         * Appends an element. Blocks while the queue is full
+         * @param item element to append
+         * @return false if the queue has been closed, true otherwise
+         */
+        bool push(T item) {
+            std::unique_lock lock(mMutex);
+            mNotFull.wait(lock, [this] { return mClosed || mItems.size() < mCapacity; });
+            if (mClosed) {
+                return false;
+            }
+
+            mItems.push_back(std::move(item));
+            lock.unlock();
+            mNotEmpty.notify_one();
+            return true;
+        }
+
+        /**
+         * Removes the first element. Blocks while the queue is empty and open
+         * @return the first element or std::nullopt if the queue is closed and empty
+         */
+        std::optional<T> pop() {
+            std::unique_lock lock(mMutex);
+            mNotEmpty.wait(lock, [this] { return mClosed || !mItems.empty(); });
+            if (mItems.empty()) {
+                return std::nullopt;
+            }
+
+            std::optional<T> item(std::move(mItems.front()));
+            mItems.pop_front();
+            lock.unlock();
+            mNotFull.notify_one();
+            return item;
+        }
+
+        /**
+         * Closes the queue. No more elements can be pushed
+         */
+        void close() {
+            {
+                std::lock_guard lock(mMutex);
+                mClosed = true;
+            }
+
+            mNotFull.notify_all();
+            mNotEmpty.notify_all();
+        }
+    };
+}
+
+#endif //BOUNDEDQUEUE_HPP
@@ -0,0 +1,274 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+
+#include <stdexcept>
+#include <algorithm>
+
+#include "Decompression.hpp"
+
+#ifdef SAT_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef SAT_HAVE_LZMA
+#include <lzma.h>
+#endif
+#ifdef SAT_HAVE_BZIP2
+#include <bzlib.h>
+#endif
+
+namespace sat {
+    namespace {
+        // Input is handed to the libraries in pieces since their length fields may only be 32 bit wide
+        constexpr std::size_t MaxInput = 1u << 30;
+
+        [[noreturn, maybe_unused]] void unsupported(Compression format) {
+            throw std::runtime_error("support for " + std::string(to_string(format)) + " compression is not available");
+        }
+
+#ifdef SAT_HAVE_ZLIB
+        void gunzip(std::string_view data, const std::function<bool(std::string)> &consumer, std::size_t chunkSize) {
+            z_stream stream{};
+            // 16 + MAX_WBITS: expect a gzip header
+            if (inflateInit2(&stream, 16 + MAX_WBITS) != Z_OK) {
+                throw std::runtime_error("cannot initialize gzip decompression");
+            }
+
+            std::size_t consumed = 0;
+            std::string chunk(chunkSize, '\0');
+            std::size_t produced = 0;
+            int ret = Z_OK;
+            while (true) {
+                if (stream.avail_in == 0 && consumed < data.size()) {
+                    const std::size_t size = std::min(MaxInput, data.size() - consumed);
+                    stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.data() + consumed));
+                    stream.avail_in = static_cast<uInt>(size);
+                    consumed += size;
+                }
+
+                stream.next_out = reinterpret_cast<Bytef *>(chunk.data() + produced);
+                stream.avail_out = static_cast<uInt>(chunkSize - produced);
+                ret = inflate(&stream, Z_NO_FLUSH);
+                produced = chunkSize - stream.avail_out;
+                if (ret == Z_STREAM_END) {
+                    // Concatenated gzip members are decompressed one after the other
+                    if (stream.avail_in == 0 && consumed == data.size()) {
+                        break;
+                    }
+
+                    inflateReset(&stream);
+                } else if (ret != Z_OK && !(ret == Z_BUF_ERROR && stream.avail_out == 0)) {
+                    inflateEnd(&stream);
+                    throw std::runtime_error("corrupt gzip data");
+                } else if (stream.avail_in == 0 && consumed == data.size() && stream.avail_out > 0) {
+                    inflateEnd(&stream);
+                    throw std::runtime_error("truncated gzip data");
+                }
+
+                if (produced == chunkSize) {
+                    if (!consumer(std::move(chunk))) {
+                        inflateEnd(&stream);
+                        return;
+                    }
+
+                    chunk.assign(chunkSize, '\0');
+                    produced = 0;
+                }
+            }
+
+            inflateEnd(&stream);
+            if (produced > 0) {
+                chunk.resize(produced);
+                consumer(std::move(chunk));
+            }
+        }
+#endif
+
+#ifdef SAT_HAVE_LZMA
+        void unxz(std::string_view data, const std::function<bool(std::string)> &consumer, std::size_t chunkSize) {
+            lzma_stream stream = LZMA_STREAM_INIT;
+            if (lzma_stream_decoder(&stream, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+                throw std::runtime_error("cannot initialize xz decompression");
+            }
+
+            stream.next_in = reinterpret_cast<const std::uint8_t *>(data.data());
+            stream.avail_in = data.size();
+            std::string chunk(chunkSize, '\0');
+            std::size_t produced = 0;
+            while (true) {
+                stream.next_out = reinterpret_cast<std::uint8_t *>(chunk.data() + produced);
+                stream.avail_out = chunkSize - produced;
+                const lzma_ret ret = lzma_code(&stream, stream.avail_in == 0 ? LZMA_FINISH : LZMA_RUN);
+                produced = chunkSize - stream.avail_out;
+                if (ret == LZMA_STREAM_END) {
+                    break;
+                }
+
+                if (ret != LZMA_OK) {
+                    lzma_end(&stream);
+                    throw std::runtime_error("corrupt xz data");
+                }
+
+                if (produced == chunkSize) {
+                    if (!consumer(std::move(chunk))) {
+                        lzma_end(&stream);
+                        return;
+                    }
+
+                    chunk.assign(chunkSize, '\0');
+                    produced = 0;
+                }
+            }
+
+            lzma_end(&stream);
+            if (produced > 0) {
+                chunk.resize(produced);
+                consumer(std::move(chunk));
+            }
+        }
+#endif
+
+#ifdef SAT_HAVE_BZIP2
+        void bunzip2(std::string_view data, const std::function<bool(std::string)> &consumer, std::size_t chunkSize) {
+            bz_stream stream{};
+            if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK) {
+                throw std::runtime_error("cannot initialize bzip2 decompression");
+            }
+
+            std::size_t consumed = 0;
+            std::string chunk(chunkSize, '\0');
+            std::size_t produced = 0;
+            while (true) {
+                if (stream.avail_in == 0 && consumed < data.size()) {
+                    const std::size_t size = std::min(MaxInput, data.size() - consumed);
+                    stream.next_in = const_cast<char *>(data.data() + consumed);
+                    stream.avail_in = static_cast<unsigned>(size);
+                    consumed += size;
+                }
+
+                stream.next_out = chunk.data() + produced;
+                stream.avail_out = static_cast<unsigned>(chunkSize - produced);
+                const int ret = BZ2_bzDecompress(&stream);
+                produced = chunkSize - stream.avail_out;
+                if (ret == BZ_STREAM_END) {
+                    if (stream.avail_in == 0 && consumed == data.size()) {
+                        break;
+                    }
+
+                    // Concatenated streams (e.g. from parallel compressors) are decompressed one after the other
+                    const char *nextIn = stream.next_in;
+                    const unsigned availIn = stream.avail_in;
+                    BZ2_bzDecompressEnd(&stream);
+                    stream = bz_stream{};
+                    if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK) {
+                        throw std::runtime_error("cannot initialize bzip2 decompression");
+                    }
+
+                    stream.next_in = const_cast<char *>(nextIn);
+                    stream.avail_in = availIn;
+                } else if (ret != BZ_OK) {
+                    BZ2_bzDecompressEnd(&stream);
+                    throw std::runtime_error("corrupt bzip2 data");
+                } else if (stream.avail_in == 0 && consumed == data.size() && stream.avail_out > 0) {
+                    BZ2_bzDecompressEnd(&stream);
+                    throw std::runtime_error("truncated bzip2 data");
+                }
+
+                if (produced == chunkSize) {
+                    if (!consumer(std::move(chunk))) {
+                        BZ2_bzDecompressEnd(&stream);
+                        return;
+                    }
+
+                    chunk.assign(chunkSize, '\0');
+                    produced = 0;
+                }
+            }
+
+            BZ2_bzDecompressEnd(&stream);
+            if (produced > 0) {
+                chunk.resize(produced);
+                consumer(std::move(chunk));
+            }
+        }
+#endif
+    }
+
+    Compression detect_compression(std::string_view data) noexcept {
+        if (data.starts_with("\x1f\x8b")) {
+            return Compression::Gzip;
+        }
+
+        if (data.starts_with(std::string_view("\xfd" "7zXZ\0", 6))) {
+            return Compression::Xz;
+        }
+
+        if (data.starts_with("BZh")) {
+            return Compression::Bzip2;
+        }
+
+        return Compression::None;
+    }
+
+    void decompress(std::string_view data, Compression format,
+                    const std::function<bool(std::string)> &consumer, std::size_t chunkSize) {
+        chunkSize = std::max<std::size_t>(chunkSize, 1);
+        switch (format) {
+            case Compression::Gzip:
+#ifdef SAT_HAVE_ZLIB
+                gunzip(data, consumer, chunkSize);
+                return;
+#else
+                unsupported(format);
+#endif
+            case Compression::Xz:
+#ifdef SAT_HAVE_LZMA
+                unxz(data, consumer, chunkSize);
+                return;
+#else
+                unsupported(format);
+#endif
+            case Compression::Bzip2:
+#ifdef SAT_HAVE_BZIP2
+                bunzip2(data, consumer, chunkSize);
+                return;
+#else
+                unsupported(format);
+#endif
+            default:
+                throw std::runtime_error("data is not compressed");
+        }
+    }
+
+    DecompressingReader::DecompressingReader(MappedFile file, Compression format, std::size_t chunkSize,
+                                             std::size_t maxChunks) : mFile(std::move(file)), mChunks(maxChunks) {
+        mWorker = std::jthread([this, format, chunkSize] {
+            try {
+                decompress(mFile.view(), format, [this](std::string chunk) {
+                    return mChunks.push(std::move(chunk));
+                }, chunkSize);
+            } catch (...) {
+                mError = std::current_exception();
+            }
+
+            mChunks.close();
+        });
+    }
+
+    DecompressingReader::~DecompressingReader() {
+        // Unblocks the worker if the queue is full. The worker is joined afterward
+        mChunks.close();
+    }
+
+    std::optional<std::string> DecompressingReader::next() {
+        auto chunk = mChunks.pop();
+        if (!chunk && mError) {
+            // The worker has finished once the queue is closed, so the error can be read safely
+            std::rethrow_exception(mError);
+        }
+
+        return chunk;
+    }
+}
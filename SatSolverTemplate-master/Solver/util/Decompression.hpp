@@ -0,0 +1,90 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @file Decompression.hpp
+* @brief Contains streaming decompression of gzip, xz and bzip2 compressed files
+*/
+
+#ifndef DECOMPRESSION_HPP
+#define DECOMPRESSION_HPP
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <optional>
+#include <exception>
+#include <thread>
+
+#include "enum.hpp"
+#include "MappedFile.hpp"
+#include "BoundedQueue.hpp"
+
+namespace sat {
+    /**
+     * @brief Supported compression formats
+     * @details Support for each format depends on the libraries available at build time (see SAT_HAVE_ZLIB,
+     * SAT_HAVE_LZMA and SAT_HAVE_BZIP2)
+     */
+    PENUM(Compression, None, Gzip, Xz, Bzip2)
+
+    /**
+     * Detects the compression format from the magic bytes at the start of the data
+     * @param data file contents
+     * @return detected format, Compression::None if the data is not compressed
+     */
+    Compression detect_compression(std::string_view data) noexcept;
+
+    /**
+     * Decompresses data and passes the output to a consumer in chunks of at most the given size. Concatenated
+     * streams are decompressed one after the other
+     * @param data compressed data
+     * @param format compression format of the data (must not be Compression::None)
+     * @param consumer receives each chunk of output. Decompression stops early if it returns false
+     * @param chunkSize maximum size of a chunk
+     * @throws std::runtime_error if the data is corrupt or support for the format is not available
+     */
+    void decompress(std::string_view data, Compression format,
+                    const std::function<bool(std::string)> &consumer, std::size_t chunkSize);
+
+    /**
+     * @brief Decompresses a file in a background thread.
+     * @details The decompressed chunks are handed over through a bounded queue, so at most a fixed number of chunks is
+     * held in memory and decompression overlaps with the processing of the output.
+     */
+    class DecompressingReader {
+        MappedFile mFile;
+        BoundedQueue<std::string> mChunks;
+        std::exception_ptr mError;
+        std::jthread mWorker;
+    public:
+        static constexpr std::size_t DefaultChunkSize = 1 << 20;
+        static constexpr std::size_t DefaultMaxChunks = 4;
+
+        /**
+         * Ctor. Starts decompression
+         * @param file compressed file
+         * @param format compression format of the file
+         * @param chunkSize maximum size of a decompressed chunk
+         * @param maxChunks maximum number of decompressed chunks that are buffered
+         */
+        DecompressingReader(MappedFile file, Compression format, std::size_t chunkSize = DefaultChunkSize,
+                            std::size_t maxChunks = DefaultMaxChunks);
+
+        DecompressingReader(const DecompressingReader &) = delete;
+        DecompressingReader &operator=(const DecompressingReader &) = delete;
+
+        /**
+         * Dtor. Stops decompression
+         */
+        ~DecompressingReader();
+
+        /**
+         * Next chunk of decompressed data. Blocks until the chunk is available
+         * @return the next chunk or std::nullopt once all data has been read
+         * @throws std::runtime_error if decompression failed
+         */
+        std::optional<std::string> next();
+    };
+}
+
+#endif //DECOMPRESSION_HPP
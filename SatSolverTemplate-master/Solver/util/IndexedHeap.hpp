@@ -0,0 +1,190 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @file IndexedHeap.hpp
+* @brief Contains a binary max-heap over integer elements with addressable keys
+*/
+
+#ifndef INDEXEDHEAP_HPP
+#define INDEXEDHEAP_HPP
+
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <cstddef>
+
+namespace sat {
+    /**
+     * @brief Binary max-heap of the elements 0, ..., n - 1.
+     * @details Each element has a key that is stored in the heap itself, whether the element is currently in the heap
+     * or not. The position of each element is tracked, so keys of contained elements can be increased in O(log n).
+     * @tparam Key key type
+     */
+    template<typename Key>
+    class IndexedMaxHeap {
+        static constexpr std::size_t NotInHeap = std::numeric_limits<std::size_t>::max();
+        std::vector<Key> mKeys;
+        std::vector<unsigned> mHeap;
+        std::vector<std::size_t> mPositions;
+
+        void moveUp(std::size_t pos) {
+            const unsigned element = mHeap[pos];
+            while (pos > 0) {
+                const std::size_t parent = (pos - 1) / 2;
+                if (!(mKeys[mHeap[parent]] < mKeys[element])) {
+                    break;
+                }
+
+                mHeap[pos] = mHeap[parent];
+                mPositions[mHeap[pos]] = pos;
+                pos = parent;
+            }
+
+            mHeap[pos] = element;
+            mPositions[element] = pos;
+        }
+
+        void moveDown(std::size_t pos) {
+            const unsigned element = mHeap[pos];
+            while (2 * pos + 1 < mHeap.size()) {
+                std::size_t child = 2 * pos + 1;
+                if (child + 1 < mHeap.size() && mKeys[mHeap[child]] < mKeys[mHeap[child + 1]]) {
+                    ++child;
+                }
+
+                if (!(mKeys[element] < mKeys[mHeap[child]])) {
+                    break;
+                }
+
+                mHeap[pos] = mHeap[child];
+                mPositions[mHeap[pos]] = pos;
+                pos = child;
+            }
+
+            mHeap[pos] = element;
+            mPositions[element] = pos;
+        }
+
+    public:
+        /**
+         * Ctor. Creates an empty heap
+         * @param numElements number of elements that can be stored in the heap
+         * @param initialKey initial key of all elements
+         */
+        explicit IndexedMaxHeap(std::size_t numElements = 0, Key initialKey = {}) :
+            mKeys(numElements, initialKey), mPositions(numElements, NotInHeap) {
+            mHeap.reserve(numElements);
+        }
+
+        /**
+         * Whether the heap contains no elements
+         */
+        bool empty() const {
+            return mHeap.empty();
+        }
+
+        /**
+         * Number of elements in the heap
+         */
+        std::size_t size() const {
+            return mHeap.size();
+        }
+
+        /**
+         * Whether the given element is currently in the heap
+         */
+        bool contains(unsigned element) const {
+            return mPositions[element] != NotInHeap;
+        }
+
+        /**
+         * Key of an element (contained in the heap or not)
+         */
+        const Key &key(unsigned element) const {
+            return mKeys[element];
+        }
+
+        /**
+         * Inserts an element. Does nothing if the element is already contained
+         * @param element element to insert
+         */
+        void push(unsigned element) {
+            if (contains(element)) {
+                return;
+            }
+
+            mHeap.push_back(element);
+            moveUp(mHeap.size() - 1);
+        }
+
+        /**
+         * Element with the largest key
+         * @note heap must not be empty
+         */
+        unsigned top() const {
+            assert(!empty());
+            return mHeap.front();
+        }
+
+        /**
+         * Removes and returns the element with the largest key
+         * @note heap must not be empty
+         */
+        unsigned pop() {
+            assert(!empty());
+            const unsigned ret = mHeap.front();
+            mPositions[ret] = NotInHeap;
+            mHeap.front() = mHeap.back();
+            mHeap.pop_back();
+            if (!mHeap.empty()) {
+                moveDown(0);
+            }
+
+            return ret;
+        }
+
+        /**
+         * Increases the key of an element and restores the heap property
+         * @param element the element
+         * @param newKey new key. Must not be smaller than the current key
+         */
+        void increase(unsigned element, Key newKey) {
+            assert(!(newKey < mKeys[element]));
+            mKeys[element] = newKey;
+            if (contains(element)) {
+                moveUp(mPositions[element]);
+            }
+        }
+
+        /**
+         * Changes the key of an element in either direction and restores the heap property
+         * @param element the element
+         * @param newKey new key
+         */
+        void update(unsigned element, Key newKey) {
+            const bool increased = mKeys[element] < newKey;
+            mKeys[element] = newKey;
+            if (!contains(element)) {
+                return;
+            }
+
+            if (increased) {
+                moveUp(mPositions[element]);
+            } else {
+                moveDown(mPositions[element]);
+            }
+        }
+
+        /**
+         * Multiplies all keys by a positive factor. This does not change the order of the elements
+         * @param factor positive scaling factor
+         */
+        void scale(Key factor) {
+            for (auto &k : mKeys) {
+                k *= factor;
+            }
+        }
+    };
+}
+
+#endif //INDEXEDHEAP_HPP
@@ -0,0 +1,108 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+
+#include <stdexcept>
+#include <utility>
+
+#include "MappedFile.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SAT_HAS_MMAP
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace sat {
+
+#ifdef SAT_HAS_MMAP
+    MappedFile::MappedFile(const std::string &path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open file " + path);
+        }
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file " + path);
+        }
+
+        mSize = static_cast<std::size_t>(info.st_size);
+        if (mSize > 0) {
+            void *data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map file " + path);
+            }
+
+            // The file is read front to back exactly once
+            ::madvise(data, mSize, MADV_SEQUENTIAL);
+            mData = static_cast<const char *>(data);
+            mMapped = true;
+        }
+
+        ::close(fd);
+    }
+
+    void MappedFile::release() noexcept {
+        if (mMapped) {
+            ::munmap(const_cast<char *>(mData), mSize);
+        }
+    }
+#else
+    MappedFile::MappedFile(const std::string &path) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) {
+            throw std::runtime_error("Cannot open file " + path);
+        }
+
+        std::ostringstream contents;
+        contents << in.rdbuf();
+        mBuffer = std::move(contents).str();
+        mData = mBuffer.data();
+        mSize = mBuffer.size();
+    }
+
+    void MappedFile::release() noexcept {}
+#endif
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept : mData(std::exchange(other.mData, nullptr)),
+                                                          mSize(std::exchange(other.mSize, 0)),
+                                                          mBuffer(std::move(other.mBuffer)),
+                                                          mMapped(std::exchange(other.mMapped, false)) {
+        if (!mMapped) {
+            mData = mBuffer.data();
+        }
+    }
+
+    MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            release();
+            mData = std::exchange(other.mData, nullptr);
+            mSize = std::exchange(other.mSize, 0);
+            mBuffer = std::move(other.mBuffer);
+            mMapped = std::exchange(other.mMapped, false);
+            if (!mMapped) {
+                mData = mBuffer.data();
+            }
+        }
+
+        return *this;
+    }
+
+    MappedFile::~MappedFile() {
+        release();
+    }
+
+    std::string_view MappedFile::view() const noexcept {
+        return {mData, mSize};
+    }
+}
@@ -0,0 +1,49 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @file MappedFile.hpp
+* @brief Contains a read-only memory mapping of a file
+*/
+
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace sat {
+    /**
+     * @brief Read-only view on the contents of a file.
+     * @details On POSIX systems, the file is mapped into memory, so its contents are only loaded on access and never
+     * copied. On other systems, the file is read into a buffer.
+     */
+    class MappedFile {
+        const char *mData = nullptr;
+        std::size_t mSize = 0;
+        std::string mBuffer;
+        bool mMapped = false;
+
+        void release() noexcept;
+    public:
+        /**
+         * Ctor. Maps the given file
+         * @param path path to the file
+         * @throws std::runtime_error if the file cannot be opened or mapped
+         */
+        explicit MappedFile(const std::string &path);
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+        ~MappedFile();
+
+        /**
+         * Contents of the file. Valid as long as this object lives
+         */
+        std::string_view view() const noexcept;
+    };
+}
+
+#endif //MAPPEDFILE_HPP
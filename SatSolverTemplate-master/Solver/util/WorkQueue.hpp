@@ -0,0 +1,78 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @file WorkQueue.hpp
+* @brief Contains the per-worker task queue of work-stealing thread pools
+*/
+
+#ifndef WORKQUEUE_HPP
+#define WORKQUEUE_HPP
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <cstddef>
+
+namespace sat {
+    /**
+     * @brief Thread safe double-ended task queue of a single worker in a work-stealing pool.
+     * @details The owner pushes and pops at the back (newest task first), other workers steal from the front (oldest
+     * task first), which tends to be the largest remaining piece of work. The queue never blocks beyond its mutex.
+     * @tparam T task type
+     */
+    template<typename T>
+    class WorkQueue {
+        mutable std::mutex mMutex;
+        std::deque<T> mTasks;
+
+    public:
+        /**
+         * Adds a task at the back
+         * @param task the task
+         */
+        void push(T task) {
+            std::lock_guard lock(mMutex);
+            mTasks.push_back(std::move(task));
+        }
+
+        /**
+         * Removes the newest task. Used by the owner
+         * @return the task or std::nullopt if the queue is empty
+         */
+        std::optional<T> pop() {
+            std::lock_guard lock(mMutex);
+            if (mTasks.empty()) {
+                return std::nullopt;
+            }
+
+            std::optional<T> task(std::move(mTasks.back()));
+            mTasks.pop_back();
+            return task;
+        }
+
+        /**
+         * Removes the oldest task. Used by other workers
+         * @return the task or std::nullopt if the queue is empty
+         */
+        std::optional<T> steal() {
+            std::lock_guard lock(mMutex);
+            if (mTasks.empty()) {
+                return std::nullopt;
+            }
+
+            std::optional<T> task(std::move(mTasks.front()));
+            mTasks.pop_front();
+            return task;
+        }
+
+        /**
+         * Number of queued tasks
+         */
+        std::size_t size() const {
+            std::lock_guard lock(mMutex);
+            return mTasks.size();
+        }
+    };
+}
+
+#endif //WORKQUEUE_HPP
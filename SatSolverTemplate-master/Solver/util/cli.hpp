@@ -57,6 +57,13 @@ namespace cli {
             static_assert(sat::traits::always_false_v<T>, "Unsupported value type");
         };
 
+        template<>
+        struct TypeParse<std::string> {
+            std::string operator()(const std::string &s) const {
+                return s;
+            }
+        };
+
         template<>
         struct TypeParse<float> {
             float operator()(const std::string &s) const {
@@ -81,6 +88,14 @@ namespace cli {
         template<sat::concepts::enum_type T>
         struct TypeParse<T> {
             T operator()(const std::string &s) const {
+                // printable enums (see PENUM) can also be specified by name
+                if constexpr (requires(T e) { from_string(s, e); }) {
+                    T e;
+                    if (from_string(s, e)) {
+                        return e;
+                    }
+                }
+
                 return static_cast<T>(std::stoi(s));
             }
         };
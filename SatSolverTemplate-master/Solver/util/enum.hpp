@@ -13,6 +13,7 @@
 #include <ranges>
 #include <type_traits>
 #include <string_view>
+#include <string>
 
 /**
  * Converts enum to underlying type
@@ -66,7 +67,8 @@ namespace enum_detail {
 
 /**
  * @brief Create a printable enum class
- * @details specify the enum class name first and then an arbitrary number of entries.
+ * @details specify the enum class name first and then an arbitrary number of entries. Entries can be converted back
+ * from their names using from_string(std::string_view, NAME &).
  * @param NAME enum class name
  * @param VA_ARGS arbitrary number of enum entries
  */
@@ -79,6 +81,16 @@ inline std::ostream &operator<<(std::ostream &os, NAME e) {
 }                                                                                                               \
 inline auto to_string(NAME e) {                                                                                 \
     return std::string(__##NAME##_converter__.at(to_underlying(e)));                                            \
+}                                                                                                               \
+inline bool from_string(std::string_view str, NAME &e) {                                                        \
+    for (std::size_t i = 0; i < __##NAME##_converter__.size(); ++i) {                                           \
+        if (__##NAME##_converter__[i] == str) {                                                                 \
+            e = static_cast<NAME>(i);                                                                           \
+            return true;                                                                                        \
+        }                                                                                                       \
+    }                                                                                                           \
+                                                                                                                \
+    return false;                                                                                               \
 }
 
 #endif //TEMPO_ENUM_HPP
@@ -12,7 +12,8 @@ namespace sat {
     }
 
     RNG & RNG::get() {
-        static RNG rng;
+        // One generator per thread, so parallel solvers neither race on nor disturb each other's sequences
+        thread_local RNG rng;
         return rng;
     }
 
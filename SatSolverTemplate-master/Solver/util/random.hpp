@@ -14,6 +14,7 @@
 namespace sat {
     /**
     * @brief Random number generator singleton class
+    * @details There is one instance per thread. Each instance starts with the same fixed seed
     */
     class RNG {
         std::random_device rd;
@@ -30,7 +31,7 @@ namespace sat {
         ~RNG() = default;
 
         /**
-        * Get the instance of the random number generator
+        * Get the instance of the random number generator of the calling thread
         * @return instance of the random number generator
         */
         static RNG &get();
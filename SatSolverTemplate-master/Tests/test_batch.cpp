@@ -0,0 +1,93 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <filesystem>
+#include <fstream>
+#include <map>
+
+#include "Batch.hpp"
+#include "testing_utils.hpp"
+
+TEST(batch, collect_from_directory) {
+    using namespace sat;
+    const auto files = collect_instances(__TEST_DATA_DIR__);
+    EXPECT_EQ(files.size(), 13);
+    EXPECT_TRUE(std::ranges::is_sorted(files));
+    EXPECT_THAT(files, testing::Contains(testing::EndsWith("sat1.cnf.xz")));
+}
+
+TEST(batch, collect_from_list) {
+    using namespace sat;
+    const auto list = (std::filesystem::temp_directory_path() / "batch_list.txt").string();
+    {
+        std::ofstream out(list);
+        out << test::TestData::SatProblem1 << "\n# comment\n\n" << test::TestData::UnsatProblem1 << "\r\n";
+    }
+
+    EXPECT_THAT(collect_instances(list), testing::ElementsAre(test::TestData::SatProblem1,
+                                                              test::TestData::UnsatProblem1));
+    EXPECT_THROW(collect_instances("does/not/exist.txt"), std::runtime_error);
+}
+
+TEST(batch, solve_instance) {
+    using namespace sat;
+    auto result = solve_instance(test::TestData::SatProblem1Gzip, 0);
+    EXPECT_EQ(result.status, BatchStatus::Sat);
+    EXPECT_GT(result.variables, 0);
+    EXPECT_EQ(solve_instance(test::TestData::UnsatProblem1, 0).status, BatchStatus::Unsat);
+
+    result = solve_instance("does/not/exist.cnf", 0);
+    EXPECT_EQ(result.status, BatchStatus::Error);
+    EXPECT_FALSE(result.error.empty());
+
+    EXPECT_EQ(solve_instance(test::TestData::SatProblem1, 1).status, BatchStatus::Memout);
+    std::stop_source stop;
+    stop.request_stop();
+    EXPECT_EQ(solve_instance(test::TestData::SatProblem1, 0, stop.get_token()).status, BatchStatus::Timeout);
+}
+
+TEST(batch, solve_batch) {
+    using namespace sat;
+    std::vector<std::string> files;
+    for (unsigned i = 0; i < 5; ++i) {
+        files.emplace_back(test::TestData::SatProblem1);
+        files.emplace_back(test::TestData::UnsatProblem1);
+    }
+
+    files.emplace_back("does/not/exist.cnf");
+    std::map<BatchStatus, unsigned> counts;
+    solve_batch(files, {.numThreads = 3, .timeout = 60}, [&counts](const BatchResult &result) {
+        ++counts[result.status];
+    });
+
+    EXPECT_THAT(counts, testing::UnorderedElementsAre(testing::Pair(BatchStatus::Sat, 5),
+                                                      testing::Pair(BatchStatus::Unsat, 5),
+                                                      testing::Pair(BatchStatus::Error, 1)));
+}
+
+TEST(batch, report_formats) {
+    using namespace sat;
+    const BatchResult result{.file = "dir/a,\"b\".cnf", .status = BatchStatus::Error, .seconds = 1.5,
+                             .variables = 3, .conflicts = 7, .error = "line 2:\tbad"};
+    EXPECT_EQ(format_result(result, ReportFormat::Jsonl),
+              "{\"file\":\"dir/a,\\\"b\\\".cnf\",\"status\":\"Error\",\"seconds\":1.500,\"variables\":3,"
+              "\"conflicts\":7,\"error\":\"line 2:\\u0009bad\"}\n");
+    EXPECT_EQ(report_header(ReportFormat::Jsonl), "");
+    EXPECT_EQ(report_header(ReportFormat::Csv), "file,status,seconds,variables,conflicts,error\n");
+    EXPECT_EQ(format_result(result, ReportFormat::Csv), "\"dir/a,\"\"b\"\".cnf\",Error,1.500,3,7,line 2:\tbad\n");
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -10,6 +10,7 @@
 
 #include "util/concepts.hpp"
 #include "Clause.hpp"
+#include "ClauseArena.hpp"
 #include "testing_utils.hpp"
 
 
@@ -78,6 +79,44 @@ TEST(clause, watcher_index) {
     EXPECT_EQ(c.getWatcherByRank(1), c[c.getIndex(1)]);
 }
 
+TEST(clause, arena_alloc) {
+    using namespace sat;
+    ClauseArena arena;
+    std::vector<Literal> lits{5, 2, 3, 4, 1};
+    auto first = arena.alloc(lits, false);
+    auto second = arena.alloc(std::vector<Literal>{7, 8}, true);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(arena[first].size(), lits.size());
+    EXPECT_TRUE(setsEqual(arena[first], test::LitSet(lits.begin(), lits.end())));
+    EXPECT_FALSE(arena[first].learnt());
+    EXPECT_TRUE(arena[second].learnt());
+    EXPECT_EQ(arena[second][0], 7);
+    EXPECT_EQ(arena[second][1], 8);
+}
+
+TEST(clause, arena_free) {
+    using namespace sat;
+    ClauseArena arena;
+    auto ref = arena.alloc(std::vector<Literal>{1, 2, 3}, false);
+    EXPECT_EQ(arena.wasted(), 0);
+    arena.free(ref);
+    EXPECT_TRUE(arena[ref].deleted());
+    EXPECT_EQ(arena.wasted(), ClauseArena::HeaderWords + 3);
+    arena.free(ref);
+    EXPECT_EQ(arena.wasted(), ClauseArena::HeaderWords + 3);
+}
+
+TEST(clause, arena_clause_id) {
+    using namespace sat;
+    ClauseArena arena;
+    auto ref = arena.alloc(std::vector<Literal>{1, 2, 3}, false);
+    EXPECT_EQ(arena[ref].id(), 0);
+    arena[ref].setId((std::uint64_t(1) << 40) + 17);
+    ClauseArena other;
+    auto moved = arena.relocate(ref, other);
+    EXPECT_EQ(other[moved].id(), (std::uint64_t(1) << 40) + 17);
+}
+
 #ifndef __RUN_ALL_TESTS__
 
 int main(int argc, char **argv) {
@@ -0,0 +1,121 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+
+#include "CubeAndConquer.hpp"
+#include "Solver.hpp"
+#include "inout.hpp"
+#include "testing_utils.hpp"
+
+bool cubeModelSatisfies(const sat::inout::DimacsProblem &problem, const std::vector<sat::TruthValue> &model) {
+    return std::ranges::all_of(problem.clauses(), [&model](auto clause) {
+        return std::ranges::any_of(clause, [&model](sat::Literal l) {
+            const auto val = model.at(sat::var(l).get());
+            return val == (l.sign() > 0 ? sat::TruthValue::True : sat::TruthValue::False);
+        });
+    });
+}
+
+sat::Solver cubeSolver(const sat::inout::DimacsProblem &problem) {
+    sat::Solver solver(static_cast<unsigned>(problem.numVariables));
+    solver.addClauses(problem.clauses());
+    return solver;
+}
+
+TEST(cube_and_conquer, split) {
+    using namespace sat;
+    // x0 fails, x2 implies the most literals among the remaining variables
+    auto problem = inout::parse_dimacs("p cnf 4 3\n-1 2 0\n-1 -2 0\n3 4 0\n");
+    auto solver = cubeSolver(problem);
+    const CubeSplitter splitter(problem);
+    auto parts = splitter.split(solver, {});
+    EXPECT_THAT(parts, testing::ElementsAre(testing::ElementsAre(neg(0), pos(2)),
+                                            testing::ElementsAre(neg(0), neg(2))));
+
+    // (x0 or x1), x1 -> x2 and x0 -> x2, so ¬x2 fails. ¬x3 implies ¬x2 and refutes every cube containing it
+    problem = inout::parse_dimacs("p cnf 4 4\n1 2 0\n-1 3 0\n-2 3 0\n-3 4 0\n");
+    solver = cubeSolver(problem);
+    const CubeSplitter other(problem);
+    parts = other.split(solver, {});
+    ASSERT_EQ(parts.size(), 2);
+    EXPECT_EQ(parts[0].back(), parts[1].back().negate());
+    EXPECT_THAT(parts[0], testing::Contains(pos(2)));
+    EXPECT_TRUE(other.split(solver, {neg(3)}).empty());
+}
+
+TEST(cube_and_conquer, cubes_cover_search_space) {
+    using namespace sat;
+    for (auto [file, satisfiable] : {std::pair(test::TestData::SatProblem1, true),
+                                     std::pair(test::TestData::UnsatProblem1, false)}) {
+        const auto problem = inout::read_dimacs_file(file);
+        auto solver = cubeSolver(problem);
+        const auto cubes = CubeSplitter(problem).cubes(solver, 16);
+        if (satisfiable) {
+            EXPECT_GT(cubes.size(), 1);
+        }
+
+        bool anySatisfiable = false;
+        for (const auto &cube : cubes) {
+            anySatisfiable |= solver.solve(cube);
+        }
+
+        EXPECT_EQ(anySatisfiable, satisfiable);
+    }
+}
+
+TEST(cube_and_conquer, solve_sat_instance) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    for (bool share : {true, false}) {
+        // A tiny budget forces cubes to be split again
+        const auto result = solve_cubes(problem, {.numThreads = 3, .cubesPerThread = 2, .conflictBudget = 1,
+                                                  .shareClauses = share});
+        ASSERT_TRUE(result.has_value());
+        EXPECT_TRUE(result->satisfiable);
+        ASSERT_EQ(result->model.size(), problem.numVariables);
+        EXPECT_TRUE(cubeModelSatisfies(problem, result->model));
+        EXPECT_GE(result->solvedCubes, 1);
+    }
+}
+
+TEST(cube_and_conquer, solve_unsat_instance) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::UnsatProblem1);
+    const auto result = solve_cubes(problem, {.numThreads = 4, .conflictBudget = 1});
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->satisfiable);
+    EXPECT_TRUE(result->model.empty());
+}
+
+TEST(cube_and_conquer, trivially_unsat) {
+    using namespace sat;
+    const auto problem = inout::parse_dimacs("p cnf 2 4\n1 0\n-1 2 0\n-2 0\n");
+    const auto result = solve_cubes(problem, {});
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->satisfiable);
+    EXPECT_EQ(result->initialCubes, 0);
+}
+
+TEST(cube_and_conquer, cancel) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    std::stop_source stop;
+    stop.request_stop();
+    EXPECT_FALSE(solve_cubes(problem, {}, stop.get_token()).has_value());
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
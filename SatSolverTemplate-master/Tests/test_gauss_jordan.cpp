@@ -0,0 +1,238 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <random>
+
+#include "GaussJordan.hpp"
+#include "Solver.hpp"
+
+// Clauses of the constraint x1 xor ... xor xk = parity, one for each assignment of the wrong parity
+std::vector<std::vector<sat::Literal>> xorClauses(const std::vector<unsigned> &variables, bool parity) {
+    using namespace sat;
+    std::vector<std::vector<Literal>> clauses;
+    for (unsigned signs = 0; signs < 1u << variables.size(); ++signs) {
+        // The clause is falsified by the assignment setting exactly the negative literals to true
+        if ((std::popcount(signs) % 2 == 0) == parity) {
+            auto &clause = clauses.emplace_back();
+            for (std::size_t i = 0; i < variables.size(); ++i) {
+                clause.push_back((signs >> i & 1) != 0 ? neg(variables[i]) : pos(variables[i]));
+            }
+        }
+    }
+
+    return clauses;
+}
+
+// Tseitin formula of the prism graph over 2 * k vertices (two cycles of length k joined by k edges) in which the
+// edges are the variables and each vertex requires an odd number of true edges if it is charged. Every vertex has
+// three edges, the formula is unsatisfiable iff the number of charged vertices is odd
+std::vector<std::vector<sat::Literal>> tseitinPrism(unsigned k, unsigned numCharged) {
+    std::vector<std::vector<sat::Literal>> clauses;
+    // Edge i: outer cycle, edge k + i: inner cycle, edge 2k + i: spoke of vertex i
+    for (unsigned i = 0; i < 2 * k; ++i) {
+        const unsigned ring = i / k * k;
+        const unsigned v = i % k;
+        const std::vector<unsigned> edges{ring + v, ring + (v + k - 1) % k, 2 * k + v};
+        std::ranges::copy(xorClauses(edges, i < numCharged), std::back_inserter(clauses));
+    }
+
+    return clauses;
+}
+
+// Checks that each explanation of the last call to assign consists of the implied literal and literals that are
+// falsified by the model and the previously implied literals
+std::vector<sat::Literal> checkedImplications(const sat::GaussJordan &gauss, std::vector<sat::TruthValue> model) {
+    using namespace sat;
+    auto value = [&model](Literal l) {
+        const auto val = model[var(l).get()];
+        if (val == TruthValue::Undefined) {
+            return val;
+        }
+
+        return (val == TruthValue::True) == (l.sign() > 0) ? TruthValue::True : TruthValue::False;
+    };
+
+    std::vector<Literal> implied;
+    for (std::size_t i = 0; i < gauss.numImplied(); ++i) {
+        const auto explanation = gauss.implied(i);
+        EXPECT_GE(explanation.size(), 2);
+        EXPECT_EQ(value(explanation[0]), TruthValue::Undefined);
+        EXPECT_TRUE(std::ranges::all_of(explanation.subspan(1), [&](Literal l) {
+            return value(l) == TruthValue::False;
+        }));
+
+        model[var(explanation[0]).get()] = explanation[0].sign() > 0 ? TruthValue::True : TruthValue::False;
+        implied.push_back(explanation[0]);
+    }
+
+    return implied;
+}
+
+TEST(gauss_jordan, recover_xors) {
+    using namespace sat;
+    auto clauses = xorClauses({0, 1, 2}, true);
+    std::ranges::reverse(clauses[1]);
+    clauses.push_back(clauses.front());
+    // Incomplete encoding
+    auto incomplete = xorClauses({3, 4, 5}, false);
+    incomplete.pop_back();
+    std::ranges::copy(incomplete, std::back_inserter(clauses));
+    std::ranges::copy(xorClauses({6, 7}, false), std::back_inserter(clauses));
+    clauses.push_back({pos(8), neg(9), pos(10), neg(11), pos(12)});
+    const auto xors = recover_xors(clauses, 4);
+    ASSERT_EQ(xors.size(), 2);
+    EXPECT_THAT(xors[0].variables, testing::ElementsAre(Variable(0), Variable(1), Variable(2)));
+    EXPECT_TRUE(xors[0].parity);
+    EXPECT_THAT(xors[1].variables, testing::ElementsAre(Variable(6), Variable(7)));
+    EXPECT_FALSE(xors[1].parity);
+}
+
+TEST(gauss_jordan, elimination) {
+    using namespace sat;
+    const std::vector<XorConstraint> cycle{{{0, 1}, true}, {{1, 2}, true}, {{0, 2}, true}};
+    EXPECT_TRUE(GaussJordan(cycle, 3).inconsistent());
+    const std::vector<XorConstraint> unit{{{0, 1, 2}, true}, {{1, 2}, false}, {{2, 3, 4}, false}};
+    GaussJordan gauss(unit, 5);
+    EXPECT_FALSE(gauss.inconsistent());
+    EXPECT_THAT(gauss.units(), testing::ElementsAre(pos(0)));
+    EXPECT_EQ(gauss.numRows(), 2);
+}
+
+TEST(gauss_jordan, propagation) {
+    using namespace sat;
+    const std::vector<XorConstraint> xors{{{0, 1, 2}, true}, {{2, 3, 4}, false}};
+    GaussJordan gauss(xors, 5);
+    std::vector<TruthValue> model(5, TruthValue::Undefined);
+    for (Literal l : {pos(1), neg(3)}) {
+        model[var(l).get()] = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+        EXPECT_TRUE(gauss.assign(var(l), model));
+        EXPECT_EQ(gauss.numImplied(), 0);
+    }
+
+    model[4] = TruthValue::False;
+    EXPECT_TRUE(gauss.assign(Variable(4), model));
+    ASSERT_EQ(gauss.numImplied(), 2);
+    // x0 = 1 xor x1 xor x2, x2 = x3 xor x4
+    EXPECT_THAT(checkedImplications(gauss, model), testing::UnorderedElementsAre(neg(0), neg(2)));
+}
+
+TEST(gauss_jordan, pivot_and_conflict) {
+    using namespace sat;
+    const std::vector<XorConstraint> xors{{{0, 1, 2}, true}, {{2, 3, 4}, false}};
+    GaussJordan gauss(xors, 5);
+    std::vector<TruthValue> model(5, TruthValue::Undefined);
+    // x2 is basic, so assigning it requires a pivot
+    model[2] = TruthValue::True;
+    EXPECT_TRUE(gauss.assign(Variable(2), model));
+    EXPECT_EQ(gauss.numPivots(), 1);
+    EXPECT_EQ(gauss.numImplied(), 0);
+    model[0] = TruthValue::True;
+    EXPECT_TRUE(gauss.assign(Variable(0), model));
+    ASSERT_EQ(gauss.numImplied(), 1);
+    EXPECT_THAT(gauss.implied(0), testing::ElementsAre(pos(1), testing::_, testing::_));
+    EXPECT_THAT(gauss.implied(0).subspan(1), testing::UnorderedElementsAre(neg(0), neg(2)));
+
+    // The opposite value falsifies the first constraint
+    model[1] = TruthValue::False;
+    EXPECT_FALSE(gauss.assign(Variable(1), model));
+    EXPECT_THAT(gauss.conflict(), testing::UnorderedElementsAre(neg(0), pos(1), neg(2)));
+}
+
+TEST(gauss_jordan, random_assignments) {
+    using namespace sat;
+    // All explanations have to be valid while variables are assigned in random order
+    const auto clauses = tseitinPrism(12, 0);
+    const auto xors = recover_xors(clauses, 3);
+    ASSERT_EQ(xors.size(), 24);
+    std::mt19937 rng(7);
+    for (unsigned round = 0; round < 20; ++round) {
+        GaussJordan gauss(xors, 36);
+        std::vector<TruthValue> model(36, TruthValue::Undefined);
+        std::vector<unsigned> order(36);
+        std::iota(order.begin(), order.end(), 0);
+        std::ranges::shuffle(order, rng);
+        bool ok = true;
+        for (std::size_t i = 0; i < order.size() && ok; ++i) {
+            if (model[order[i]] != TruthValue::Undefined) {
+                continue;
+            }
+
+            // Implied literals are assigned in the order they were found, like the solver does
+            std::vector<Literal> queue{rng() % 2 == 0 ? pos(order[i]) : neg(order[i])};
+            for (std::size_t next = 0; next < queue.size() && ok; ++next) {
+                const Literal l = queue[next];
+                const TruthValue val = l.sign() > 0 ? TruthValue::True : TruthValue::False;
+                if (model[var(l).get()] != TruthValue::Undefined) {
+                    // An implied literal that is falsified already is a conflict
+                    ok = model[var(l).get()] == val;
+                    continue;
+                }
+
+                model[var(l).get()] = val;
+                ok = gauss.assign(var(l), model);
+                if (!ok) {
+                    EXPECT_TRUE(std::ranges::all_of(gauss.conflict(), [&model](Literal c) {
+                        return model[var(c).get()] == (c.sign() > 0 ? TruthValue::False : TruthValue::True);
+                    }));
+                } else {
+                    std::ranges::copy(checkedImplications(gauss, model), std::back_inserter(queue));
+                }
+            }
+        }
+
+        // The basic variables of unfinished rows are unassigned, so propagation never leaves the constraints
+        // without solution and decisions cannot lead to conflicts
+        EXPECT_TRUE(ok);
+        EXPECT_TRUE(std::ranges::all_of(clauses, [&model](const auto &clause) {
+            return std::ranges::any_of(clause, [&model](Literal l) {
+                return model[var(l).get()] == (l.sign() > 0 ? TruthValue::True : TruthValue::False);
+            });
+        }));
+    }
+}
+
+TEST(gauss_jordan, solver) {
+    using namespace sat;
+    for (unsigned numCharged : {1u, 2u}) {
+        const auto clauses = tseitinPrism(20, numCharged);
+        Solver solver(60);
+        Solver plain(60);
+        plain.useGaussJordan(false);
+        for (const auto &clause : clauses) {
+            solver.addClause(Clause(clause));
+            plain.addClause(Clause(clause));
+        }
+
+        const bool satisfiable = numCharged % 2 == 0;
+        EXPECT_EQ(solver.solve(), satisfiable);
+        EXPECT_EQ(solver.numXors(), 40);
+        EXPECT_EQ(plain.solve(), satisfiable);
+        EXPECT_LE(solver.numConflicts(), plain.numConflicts());
+        if (satisfiable) {
+            EXPECT_TRUE(std::ranges::all_of(clauses, [&solver](const auto &clause) {
+                return std::ranges::any_of(clause, [&solver](Literal l) { return solver.satisfied(l); });
+            }));
+        } else {
+            // The constraints sum up to 0 = 1
+            EXPECT_EQ(solver.numConflicts(), 0);
+        }
+    }
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
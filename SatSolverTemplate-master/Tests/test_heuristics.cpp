@@ -0,0 +1,148 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+#include <algorithm>
+
+#include "heuristics.hpp"
+#include "util/IndexedHeap.hpp"
+
+TEST(heuristics, heap_order) {
+    using namespace sat;
+    IndexedMaxHeap<double> heap(6);
+    std::vector<double> keys{3, 1, 4, 1.5, 9, 2.6};
+    for (unsigned i = 0; i < keys.size(); ++i) {
+        heap.increase(i, keys[i]);
+        heap.push(i);
+    }
+
+    EXPECT_EQ(heap.size(), keys.size());
+    heap.increase(1, 10);
+    std::vector<unsigned> order;
+    while (!heap.empty()) {
+        order.push_back(heap.pop());
+    }
+
+    EXPECT_THAT(order, testing::ElementsAre(1, 4, 2, 0, 5, 3));
+    EXPECT_FALSE(heap.contains(1));
+    heap.push(1);
+    heap.push(1);
+    EXPECT_EQ(heap.size(), 1);
+}
+
+TEST(heuristics, vsids_prefers_bumped_variables) {
+    using namespace sat;
+    std::vector model(5, TruthValue::Undefined);
+    VSIDS vsids(model.size());
+    vsids.bump(3);
+    vsids.decay();
+    vsids.bump(1);
+    vsids.bump(1);
+    EXPECT_GT(vsids.activity(1), vsids.activity(3));
+    EXPECT_EQ(vsids(model, 5), 1);
+    model[1] = TruthValue::True;
+    EXPECT_EQ(vsids(model, 4), 3);
+    model[3] = TruthValue::False;
+    model[1] = TruthValue::Undefined;
+    vsids.reinsert(1);
+    EXPECT_EQ(vsids(model, 4), 1);
+}
+
+TEST(heuristics, vsids_skips_assigned_variables) {
+    using namespace sat;
+    std::vector model(3, TruthValue::True);
+    model[2] = TruthValue::Undefined;
+    VSIDS vsids(model.size());
+    EXPECT_EQ(vsids(model, 1), 2);
+    EXPECT_THROW(vsids(model, 0), std::runtime_error);
+}
+
+TEST(heuristics, vsids_rescaling_keeps_order) {
+    using namespace sat;
+    std::vector model(2, TruthValue::Undefined);
+    VSIDS vsids(model.size(), 0.5);
+    vsids.bump(0);
+    for (int i = 0; i < 400; ++i) {
+        vsids.decay();
+    }
+
+    vsids.bump(1);
+    EXPECT_GT(vsids.activity(1), vsids.activity(0));
+    EXPECT_EQ(vsids(model, 2), 1);
+}
+
+TEST(heuristics, phase_saving) {
+    using namespace sat;
+    Phases phases(3);
+    EXPECT_EQ(phases.decide(Variable(1)), pos(Variable(1)));
+    phases.save(neg(Variable(1)));
+    EXPECT_EQ(phases.decide(Variable(1)), neg(Variable(1)));
+    EXPECT_EQ(phases.decide(Variable(2)), pos(Variable(2)));
+}
+
+TEST(heuristics, target_phase_overrides_saved_phase) {
+    using namespace sat;
+    Phases phases(3);
+    const std::vector trail{neg(Variable(0)), neg(Variable(1))};
+    phases.update(trail);
+    phases.save(pos(Variable(0)));
+    EXPECT_EQ(phases.decide(Variable(0)), neg(Variable(0)));
+    // smaller trails do not replace the target
+    phases.update(std::vector{pos(Variable(1))});
+    EXPECT_EQ(phases.decide(Variable(1)), neg(Variable(1)));
+    phases.resetTarget();
+    phases.update(std::vector{pos(Variable(1))});
+    EXPECT_EQ(phases.decide(Variable(1)), pos(Variable(1)));
+    phases.useTarget(false);
+    EXPECT_EQ(phases.decide(Variable(0)), pos(Variable(0)));
+}
+
+TEST(heuristics, rephase_schedule) {
+    using namespace sat;
+    Phases phases(2);
+    phases.update(std::vector{neg(Variable(0))});
+    EXPECT_FALSE(phases.shouldRephase(Phases::RephaseInterval - 1));
+    EXPECT_TRUE(phases.shouldRephase(Phases::RephaseInterval));
+    std::size_t conflicts = 0;
+    for (Rephase expected : Phases::Schedule) {
+        EXPECT_EQ(phases.rephase(conflicts), expected);
+        switch (expected) {
+            case Rephase::Original:
+                EXPECT_EQ(phases.decide(Variable(0)), pos(Variable(0)));
+                EXPECT_EQ(phases.decide(Variable(1)), pos(Variable(1)));
+                break;
+            case Rephase::Inverted:
+                EXPECT_EQ(phases.decide(Variable(0)), neg(Variable(0)));
+                EXPECT_EQ(phases.decide(Variable(1)), neg(Variable(1)));
+                break;
+            default:
+                break;
+        }
+
+        EXPECT_FALSE(phases.shouldRephase(conflicts));
+        conflicts += 10000;
+    }
+
+    // The first best rephase uses the recorded best trail
+    Phases best(2);
+    best.update(std::vector{neg(Variable(0))});
+    best.rephase(0);
+    EXPECT_EQ(best.rephase(0), Rephase::Best);
+    EXPECT_EQ(best.decide(Variable(0)), neg(Variable(0)));
+    EXPECT_EQ(best.decide(Variable(1)), pos(Variable(1)));
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,267 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <fstream>
+#include <vector>
+#include <filesystem>
+
+#include "inout.hpp"
+#include "BinaryCnf.hpp"
+#include "util/MappedFile.hpp"
+#include "util/Decompression.hpp"
+#include "testing_utils.hpp"
+
+auto problemClauses(const sat::inout::DimacsProblem &problem) {
+    std::vector<std::vector<sat::Literal>> clauses;
+    for (std::size_t i = 0; i < problem.numClauses(); ++i) {
+        auto clause = problem.clause(i);
+        clauses.emplace_back(clause.begin(), clause.end());
+    }
+
+    return clauses;
+}
+
+TEST(inout, parse_dimacs) {
+    using namespace sat;
+    const auto problem = inout::parse_dimacs("c a comment\np cnf 3 2\n1 -2 0\n-3 0\n");
+    EXPECT_EQ(problem.numVariables, 3);
+    ASSERT_EQ(problem.numClauses(), 2);
+    EXPECT_THAT(problem.clause(0), testing::ElementsAre(pos(0), neg(1)));
+    EXPECT_THAT(problem.clause(1), testing::ElementsAre(neg(2)));
+}
+
+TEST(inout, parse_dimacs_clause_layout) {
+    using namespace sat;
+    // clauses spanning lines, sharing a line, comments in between and a missing final terminator
+    const auto problem = inout::parse_dimacs("p  cnf 4 4\r\n1 2\n3 0 -1\nc comment\n 0 4 0 \t-4 -3");
+    ASSERT_EQ(problem.numClauses(), 4);
+    EXPECT_THAT(problem.clause(0), testing::ElementsAre(pos(0), pos(1), pos(2)));
+    EXPECT_THAT(problem.clause(1), testing::ElementsAre(neg(0)));
+    EXPECT_THAT(problem.clause(2), testing::ElementsAre(pos(3)));
+    EXPECT_THAT(problem.clause(3), testing::ElementsAre(neg(3), neg(2)));
+    EXPECT_EQ(inout::parse_dimacs("p cnf 2 1\n1 2 0\n%\n0\n").numClauses(), 1);
+}
+
+TEST(inout, parse_dimacs_errors) {
+    using namespace sat;
+    EXPECT_THROW(inout::parse_dimacs("1 2 0\n"), std::runtime_error);
+    EXPECT_THROW(inout::parse_dimacs("p cnf 2 1\n1 3 0\n"), std::runtime_error);
+    EXPECT_THROW(inout::parse_dimacs("p cnf 2 1\n1 x 0\n"), std::runtime_error);
+    EXPECT_THROW(inout::parse_dimacs("p cnf 2 1\n1 2a 0\n"), std::runtime_error);
+    EXPECT_THROW(inout::parse_dimacs("p dnf 2 1\n1 2 0\n"), std::runtime_error);
+    EXPECT_THROW(inout::parse_dimacs("p cnf 99999999999 1\n"), std::runtime_error);
+}
+
+TEST(inout, read_dimacs_file) {
+    using namespace sat;
+    for (auto file : {test::TestData::SatProblem1, test::TestData::UnsatProblem1,
+                      test::TestData::UnitPropagationProblem1}) {
+        std::ifstream in(file);
+        ASSERT_TRUE(in.is_open());
+        auto [clauses, numVariables] = inout::read_from_dimacs(in);
+        const auto problem = inout::read_dimacs_file(file);
+        EXPECT_EQ(problem.numVariables, numVariables);
+        EXPECT_EQ(problemClauses(problem), clauses);
+    }
+
+    EXPECT_THROW(inout::read_dimacs_file(__TEST_DATA_DIR__ "does_not_exist.cnf"), std::runtime_error);
+}
+
+struct CountingSink {
+    std::size_t numVariables = 0;
+    std::size_t declaredClauses = 0;
+    std::size_t literals = 0;
+    std::size_t clauses = 0;
+
+    void header(std::size_t numVars, std::size_t numClauses) {
+        numVariables = numVars;
+        declaredClauses = numClauses;
+    }
+
+    void literal(sat::Literal) {
+        ++literals;
+    }
+
+    void endClause() {
+        ++clauses;
+    }
+};
+
+TEST(inout, parse_dimacs_into_sink) {
+    static_assert(sat::inout::dimacs_sink<CountingSink>);
+    CountingSink sink;
+    sat::inout::parse_dimacs("p cnf 5 3\n1 -2 0 3\n0 4 5 -1 0\n", sink);
+    EXPECT_EQ(sink.numVariables, 5);
+    EXPECT_EQ(sink.declaredClauses, 3);
+    EXPECT_EQ(sink.clauses, 3);
+    EXPECT_EQ(sink.literals, 6);
+}
+
+TEST(inout, mapped_file) {
+    using namespace sat;
+    MappedFile file(test::TestData::UnitPropagationProblem1);
+    std::ifstream in(test::TestData::UnitPropagationProblem1, std::ios::binary);
+    const std::string contents(std::istreambuf_iterator<char>(in), {});
+    EXPECT_EQ(file.view(), contents);
+    MappedFile moved(std::move(file));
+    EXPECT_EQ(moved.view(), contents);
+}
+
+std::string fileContents(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), {}};
+}
+
+TEST(inout, parse_dimacs_in_pieces) {
+    using namespace sat;
+    const std::string text = fileContents(test::TestData::SatProblem1);
+    const auto expected = problemClauses(inout::parse_dimacs(text));
+    for (std::size_t pieceSize : {1, 2, 3, 7, 64}) {
+        inout::DimacsProblem problem;
+        inout::DimacsParser parser(problem);
+        for (std::size_t pos = 0; pos < text.size(); pos += pieceSize) {
+            parser.feed(std::string_view(text).substr(pos, pieceSize));
+        }
+
+        parser.finish();
+        EXPECT_EQ(problemClauses(problem), expected) << "piece size " << pieceSize;
+    }
+}
+
+TEST(inout, detect_compression) {
+    using namespace sat;
+    EXPECT_EQ(detect_compression(fileContents(test::TestData::SatProblem1)), Compression::None);
+    EXPECT_EQ(detect_compression(fileContents(test::TestData::SatProblem1Gzip)), Compression::Gzip);
+    EXPECT_EQ(detect_compression(fileContents(test::TestData::SatProblem1Xz)), Compression::Xz);
+    EXPECT_EQ(detect_compression(fileContents(test::TestData::SatProblem1Bzip2)), Compression::Bzip2);
+    EXPECT_EQ(detect_compression(""), Compression::None);
+}
+
+#if defined(SAT_HAVE_ZLIB) && defined(SAT_HAVE_LZMA) && defined(SAT_HAVE_BZIP2)
+TEST(inout, decompress) {
+    using namespace sat;
+    const std::string plain = fileContents(test::TestData::SatProblem1);
+    for (auto file : {test::TestData::SatProblem1Gzip, test::TestData::SatProblem1Xz,
+                      test::TestData::SatProblem1Bzip2}) {
+        const std::string compressed = fileContents(file);
+        const Compression format = detect_compression(compressed);
+        std::string output;
+        std::size_t numChunks = 0;
+        decompress(compressed, format, [&](std::string chunk) {
+            EXPECT_LE(chunk.size(), 100);
+            output += chunk;
+            ++numChunks;
+            return true;
+        }, 100);
+        EXPECT_EQ(output, plain) << file;
+        EXPECT_EQ(numChunks, (plain.size() + 99) / 100);
+
+        // concatenated streams
+        output.clear();
+        decompress(compressed + compressed, format, [&output](std::string chunk) {
+            output += chunk;
+            return true;
+        }, 1 << 10);
+        EXPECT_EQ(output, plain + plain) << file;
+
+        // early stop
+        numChunks = 0;
+        decompress(compressed, format, [&numChunks](std::string) { return ++numChunks < 2; }, 10);
+        EXPECT_EQ(numChunks, 2);
+
+        const auto truncated = compressed.substr(0, compressed.size() / 2);
+        EXPECT_THROW(decompress(truncated, format, [](std::string) { return true; }, 100), std::runtime_error);
+    }
+}
+
+TEST(inout, decompressing_reader) {
+    using namespace sat;
+    const std::string plain = fileContents(test::TestData::SatProblem1);
+    DecompressingReader reader(MappedFile(test::TestData::SatProblem1Xz), Compression::Xz, 16, 1);
+    std::string output;
+    while (auto chunk = reader.next()) {
+        output += *chunk;
+    }
+
+    EXPECT_EQ(output, plain);
+    // Destroying a reader whose worker is blocked on the full queue must not hang
+    DecompressingReader abandoned(MappedFile(test::TestData::SatProblem1Gzip), Compression::Gzip, 1, 1);
+    EXPECT_TRUE(abandoned.next().has_value());
+}
+
+TEST(inout, read_compressed_dimacs_file) {
+    using namespace sat;
+    const auto expected = problemClauses(inout::read_dimacs_file(test::TestData::SatProblem1));
+    for (auto file : {test::TestData::SatProblem1Gzip, test::TestData::SatProblem1Xz,
+                      test::TestData::SatProblem1Bzip2}) {
+        const auto problem = inout::read_dimacs_file(file);
+        EXPECT_EQ(problem.numVariables, 20);
+        EXPECT_EQ(problemClauses(problem), expected) << file;
+    }
+}
+#endif
+
+TEST(inout, binary_cnf_roundtrip) {
+    using namespace sat;
+    const auto path = (std::filesystem::temp_directory_path() / "test_inout_roundtrip.bcnf").string();
+    const auto problem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    inout::write_binary_cnf(path, problem);
+    EXPECT_TRUE(inout::is_binary_cnf(fileContents(path)));
+    {
+        const inout::BinaryProblem binary(path);
+        EXPECT_EQ(binary.numVariables(), problem.numVariables);
+        EXPECT_EQ(binary.numLiterals(), problem.literals.size());
+        ASSERT_EQ(binary.numClauses(), problem.numClauses());
+        for (std::size_t i = 0; i < problem.numClauses(); ++i) {
+            EXPECT_TRUE(std::ranges::equal(binary.clause(i), problem.clause(i)));
+        }
+    }
+
+    // both formats can be read through the same interface
+    inout::DimacsProblem fromBinary;
+    inout::read_problem_file(path, fromBinary);
+    EXPECT_EQ(problemClauses(fromBinary), problemClauses(problem));
+    inout::DimacsProblem fromText;
+    inout::read_problem_file(test::TestData::SatProblem1, fromText);
+    EXPECT_EQ(problemClauses(fromText), problemClauses(problem));
+    std::filesystem::remove(path);
+}
+
+TEST(inout, binary_cnf_validation) {
+    using namespace sat;
+    const auto path = (std::filesystem::temp_directory_path() / "test_inout_validation.bcnf").string();
+    inout::write_binary_cnf(path, inout::read_dimacs_file(test::TestData::SatProblem1));
+    const std::string contents = fileContents(path);
+    auto writeFile = [&path](const std::string &data) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << data;
+    };
+
+    // corrupt literal
+    std::string corrupt = contents;
+    corrupt[corrupt.size() - 3] ^= 1;
+    writeFile(corrupt);
+    EXPECT_THROW(inout::BinaryProblem{path}, std::runtime_error);
+    writeFile(contents.substr(0, contents.size() - 4));
+    EXPECT_THROW(inout::BinaryProblem{path}, std::runtime_error);
+    writeFile(contents.substr(0, 20));
+    EXPECT_THROW(inout::BinaryProblem{path}, std::runtime_error);
+    EXPECT_THROW(inout::BinaryProblem{test::TestData::SatProblem1}, std::runtime_error);
+    writeFile(contents);
+    EXPECT_NO_THROW(inout::BinaryProblem{path});
+    std::filesystem::remove(path);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,227 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <set>
+#include <tuple>
+#include <thread>
+
+#include "Portfolio.hpp"
+#include "ClauseExchange.hpp"
+#include "Solver.hpp"
+#include "inout.hpp"
+#include "testing_utils.hpp"
+
+bool portfolioModelSatisfies(const sat::inout::DimacsProblem &problem, const std::vector<sat::TruthValue> &model) {
+    return std::ranges::all_of(problem.clauses(), [&model](auto clause) {
+        return std::ranges::any_of(clause, [&model](sat::Literal l) {
+            const auto val = model.at(sat::var(l).get());
+            return val == (l.sign() > 0 ? sat::TruthValue::True : sat::TruthValue::False);
+        });
+    });
+}
+
+TEST(portfolio, configs_are_diverse) {
+    using namespace sat;
+    const auto configs = portfolio_configs(8);
+    ASSERT_EQ(configs.size(), 8);
+    EXPECT_EQ(configs.front().branching, Branching::Activity);
+    EXPECT_EQ(configs.front().restarts, RestartPolicy::Glucose);
+    EXPECT_EQ(configs.front().polarity, Polarity::Positive);
+    std::set<std::tuple<unsigned, Branching, RestartPolicy, Polarity, bool>> distinct;
+    std::set<Branching> branchings;
+    for (const auto &config : configs) {
+        distinct.emplace(config.seed, config.branching, config.restarts, config.polarity, config.targetPhases);
+        branchings.insert(config.branching);
+    }
+
+    EXPECT_EQ(distinct.size(), configs.size());
+    EXPECT_EQ(branchings.size(), 3);
+}
+
+TEST(portfolio, solve_sat_instance) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    const auto configs = portfolio_configs(4);
+    const auto result = solve_portfolio(problem, configs);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->satisfiable);
+    EXPECT_LT(result->winner, configs.size());
+    ASSERT_EQ(result->model.size(), problem.numVariables);
+    EXPECT_TRUE(portfolioModelSatisfies(problem, result->model));
+}
+
+TEST(portfolio, solve_unsat_instance) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::UnsatProblem1);
+    const auto result = solve_portfolio(problem, portfolio_configs(4));
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->satisfiable);
+    EXPECT_TRUE(result->model.empty());
+}
+
+TEST(portfolio, every_member_solves) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    for (const auto &config : portfolio_configs(6)) {
+        const auto result = solve_portfolio(problem, std::span(&config, 1));
+        ASSERT_TRUE(result.has_value());
+        EXPECT_TRUE(result->satisfiable) << config.branching << ", " << config.restarts;
+        EXPECT_TRUE(portfolioModelSatisfies(problem, result->model));
+    }
+}
+
+TEST(portfolio, cancel) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::UnsatProblem1);
+    std::stop_source stop;
+    stop.request_stop();
+    EXPECT_FALSE(solve_portfolio(problem, portfolio_configs(4), true, stop.get_token()).has_value());
+}
+
+TEST(portfolio, solve_without_sharing) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    const auto result = solve_portfolio(problem, portfolio_configs(3), false);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->satisfiable);
+    EXPECT_TRUE(result->exchange.empty());
+    EXPECT_TRUE(portfolioModelSatisfies(problem, result->model));
+}
+
+TEST(clause_exchange, publish_read) {
+    using namespace sat;
+    ClauseExchange exchange(4);
+    SharedClause clause;
+    EXPECT_EQ(exchange.read(0, clause), ClauseExchange::ReadResult::Pending);
+    const std::vector<Literal> c1{pos(0), neg(3)};
+    ASSERT_TRUE(exchange.publish(2, c1, 2));
+    ASSERT_EQ(exchange.read(0, clause), ClauseExchange::ReadResult::Ok);
+    EXPECT_EQ(clause.source, 2);
+    EXPECT_EQ(clause.lbd, 2);
+    EXPECT_EQ(clause.literals, c1);
+    EXPECT_EQ(exchange.read(1, clause), ClauseExchange::ReadResult::Pending);
+
+    const std::vector<Literal> tooLarge(ClauseExchange::MaxLiterals + 1, pos(1));
+    EXPECT_FALSE(exchange.publish(0, tooLarge, 1));
+
+    // Positions 1 to 5 overwrite position 0 and 1
+    for (unsigned i = 0; i < 5; ++i) {
+        const std::vector<Literal> c{pos(i)};
+        ASSERT_TRUE(exchange.publish(0, c, 1));
+    }
+
+    EXPECT_EQ(exchange.oldest(), 2);
+    EXPECT_EQ(exchange.read(0, clause), ClauseExchange::ReadResult::Lost);
+    ASSERT_EQ(exchange.read(5, clause), ClauseExchange::ReadResult::Ok);
+    EXPECT_THAT(clause.literals, testing::ElementsAre(pos(4)));
+}
+
+TEST(clause_exchange, port_filters_clauses) {
+    using namespace sat;
+    ClauseExchange exchange;
+    ExchangePort sender(exchange, 0, 3, 2);
+    ExchangePort receiver(exchange, 1, 3, 2);
+    const std::vector<Literal> shortClause{pos(0), neg(1), pos(2)};
+    const std::vector<Literal> longClause{pos(0), pos(1), pos(2), pos(3), pos(4)};
+    EXPECT_TRUE(sender.offer(shortClause, 3));
+    const std::vector<Literal> permuted{pos(2), pos(0), neg(1)};
+    EXPECT_FALSE(sender.offer(permuted, 3)) << "duplicate";
+    EXPECT_FALSE(sender.offer(longClause, 3)) << "long clause with high LBD";
+    EXPECT_TRUE(sender.offer(longClause, 2));
+    EXPECT_EQ(sender.stats().exported, 2);
+
+    std::vector<std::vector<Literal>> received;
+    auto collect = [&received](std::span<const Literal> clause, unsigned) {
+        received.emplace_back(clause.begin(), clause.end());
+    };
+
+    sender.receive(collect);
+    EXPECT_TRUE(received.empty()) << "own clauses must not be imported";
+    receiver.receive(collect);
+    EXPECT_THAT(received, testing::ElementsAre(shortClause, longClause));
+    EXPECT_EQ(receiver.stats().imported, 2);
+
+    // Clauses that have been imported are not exported again
+    EXPECT_FALSE(receiver.offer(shortClause, 1));
+    receiver.receive(collect);
+    EXPECT_EQ(received.size(), 2);
+}
+
+TEST(clause_exchange, concurrent_publishers) {
+    using namespace sat;
+    constexpr unsigned NumThreads = 4;
+    constexpr unsigned NumClauses = 1000;
+    ClauseExchange exchange(NumThreads * NumClauses);
+    {
+        std::vector<std::jthread> publishers;
+        for (unsigned t = 0; t < NumThreads; ++t) {
+            publishers.emplace_back([&exchange, t] {
+                for (unsigned i = 0; i < NumClauses; ++i) {
+                    const std::vector<Literal> clause{pos(t), pos(i), neg(i)};
+                    exchange.publish(t, clause, i);
+                }
+            });
+        }
+    }
+
+    std::vector<unsigned> counts(NumThreads, 0);
+    SharedClause clause;
+    for (std::uint64_t position = 0; position < NumThreads * NumClauses; ++position) {
+        ASSERT_EQ(exchange.read(position, clause), ClauseExchange::ReadResult::Ok);
+        ASSERT_EQ(clause.literals.size(), 3);
+        EXPECT_EQ(clause.literals[0], pos(clause.source));
+        EXPECT_EQ(clause.literals[1], pos(clause.lbd));
+        ++counts.at(clause.source);
+    }
+
+    EXPECT_THAT(counts, testing::Each(NumClauses));
+}
+
+TEST(clause_exchange, solver_imports_clauses) {
+    using namespace sat;
+    const auto problem = inout::read_dimacs_file(test::TestData::UnsatProblem1);
+    ClauseExchange exchange;
+    ExchangePort port1(exchange, 0);
+    ExchangePort port2(exchange, 1);
+    Solver first(static_cast<unsigned>(problem.numVariables));
+    first.setExchange(&port1);
+    ASSERT_TRUE(first.addClauses(problem.clauses()));
+    EXPECT_FALSE(first.solve());
+
+    // The second solver is refuted with the help of the clauses of the first one
+    Solver second(static_cast<unsigned>(problem.numVariables));
+    second.setExchange(&port2);
+    ASSERT_TRUE(second.addClauses(problem.clauses()));
+    EXPECT_FALSE(second.solve());
+    EXPECT_GT(port1.stats().exported, 0);
+    EXPECT_GT(port2.stats().imported, 0);
+    EXPECT_LE(port2.stats().used, port2.stats().imported);
+}
+
+TEST(clause_exchange, no_sharing_with_proofs) {
+    using namespace sat;
+    ClauseExchange exchange;
+    ExchangePort port(exchange, 0);
+    Proof proof("/tmp/clause_exchange_test.drat", ProofFormat::Drat);
+    Solver s(2);
+    s.setProof(&proof);
+    EXPECT_THROW(s.setExchange(&port), std::runtime_error);
+    s.setProof(nullptr);
+    proof.close();
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
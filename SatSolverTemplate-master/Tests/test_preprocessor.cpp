@@ -0,0 +1,145 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+
+#include "Preprocessor.hpp"
+#include "Solver.hpp"
+#include "inout.hpp"
+#include "testing_utils.hpp"
+
+bool extendedModelSatisfies(const sat::inout::DimacsProblem &problem, const std::vector<sat::TruthValue> &model) {
+    return std::ranges::all_of(problem.clauses(), [&model](auto clause) {
+        return std::ranges::any_of(clause, [&model](sat::Literal l) {
+            const auto val = model.at(sat::var(l).get());
+            return val == (l.sign() > 0 ? sat::TruthValue::True : sat::TruthValue::False);
+        });
+    });
+}
+
+std::optional<std::vector<sat::TruthValue>> solvePreprocessed(const sat::inout::DimacsProblem &problem) {
+    sat::Preprocessor preprocessor(problem);
+    if (!preprocessor.eliminateVariables()) {
+        return std::nullopt;
+    }
+
+    const auto simplified = preprocessor.problem();
+    sat::Solver solver(static_cast<unsigned>(simplified.numVariables));
+    if (!solver.addClauses(simplified.clauses()) || !solver.solve()) {
+        return std::nullopt;
+    }
+
+    std::vector<sat::TruthValue> model;
+    for (unsigned x = 0; x < simplified.numVariables; ++x) {
+        model.push_back(solver.val(sat::Variable(x)));
+    }
+
+    preprocessor.extend(model);
+    return model;
+}
+
+TEST(preprocessor, elimination_stack) {
+    using namespace sat;
+    EliminationStack stack;
+    // Eliminating x0 from (x0 or x1), (¬x0 or x2)
+    stack.push(pos(0), std::vector{pos(0), pos(1)});
+    stack.push(neg(0), std::vector{neg(0), pos(2)});
+    EXPECT_EQ(stack.size(), 2);
+    // Models of the resolvent (x1 or x2) are repaired
+    std::vector model{TruthValue::True, TruthValue::True, TruthValue::False};
+    stack.extend(model);
+    EXPECT_EQ(model[0], TruthValue::False);
+    model = {TruthValue::False, TruthValue::False, TruthValue::True};
+    stack.extend(model);
+    EXPECT_EQ(model[0], TruthValue::True);
+}
+
+TEST(preprocessor, eliminate_variables) {
+    using namespace sat;
+    // x0 is replaced by the resolvent (x1 or x2 or x3), x4 only occurs positively
+    const auto problem = inout::parse_dimacs("p cnf 5 4\n1 2 0\n-1 3 4 0\n-2 -3 0\n5 -4 0\n");
+    Preprocessor preprocessor(problem);
+    ASSERT_TRUE(preprocessor.eliminateVariables());
+    EXPECT_GE(preprocessor.numEliminated(), 2);
+    EXPECT_LT(preprocessor.numClauses(), problem.numClauses());
+    const auto simplified = preprocessor.problem();
+    EXPECT_EQ(simplified.numVariables, problem.numVariables);
+    for (auto clause : simplified.clauses()) {
+        EXPECT_TRUE(std::ranges::none_of(clause, [](Literal l) { return var(l) == Variable(0); }));
+    }
+
+    const auto model = solvePreprocessed(problem);
+    ASSERT_TRUE(model.has_value());
+    EXPECT_TRUE(extendedModelSatisfies(problem, *model));
+}
+
+TEST(preprocessor, units) {
+    using namespace sat;
+    const auto problem = inout::parse_dimacs("p cnf 4 4\n1 0\n-1 2 0\n-2 3 4 0\n-3 -4 0\n");
+    Preprocessor preprocessor(problem);
+    ASSERT_TRUE(preprocessor.ok());
+    const auto simplified = preprocessor.problem();
+    ASSERT_GE(simplified.numClauses(), 2);
+    EXPECT_EQ(simplified.clause(0).size(), 1);
+    EXPECT_EQ(simplified.clause(1).size(), 1);
+    const auto model = solvePreprocessed(problem);
+    ASSERT_TRUE(model.has_value());
+    EXPECT_TRUE(extendedModelSatisfies(problem, *model));
+
+    EXPECT_FALSE(Preprocessor(inout::parse_dimacs("p cnf 2 3\n1 0\n-1 2 0\n-2 0\n")).ok());
+    Preprocessor unsat(inout::parse_dimacs("p cnf 2 4\n1 2 0\n1 -2 0\n-1 2 0\n-1 -2 0\n"));
+    EXPECT_TRUE(unsat.ok());
+    EXPECT_FALSE(unsat.eliminateVariables());
+}
+
+TEST(preprocessor, substitute_equivalences) {
+    using namespace sat;
+    // x0 -> x1 -> x2 -> x0 and ¬x3 <-> x1, so x1, x2 and ¬x3 are replaced by x0
+    const auto problem = inout::parse_dimacs("p cnf 5 7\n-1 2 0\n-2 3 0\n-3 1 0\n4 2 0\n-4 -2 0\n"
+                                             "-2 4 5 0\n1 -3 -5 0\n");
+    Preprocessor preprocessor(problem);
+    ASSERT_TRUE(preprocessor.substituteEquivalences());
+    EXPECT_EQ(preprocessor.numSubstituted(), 3);
+    // (¬x1 or x3 or x4) becomes (¬x0 or x4), (x0 or ¬x2 or ¬x4) becomes the tautology (x0 or ¬x0 or ¬x4)
+    EXPECT_EQ(preprocessor.numClauses(), 1);
+    const auto simplified = preprocessor.problem();
+    ASSERT_EQ(simplified.numClauses(), 1);
+    EXPECT_THAT(simplified.clause(0), testing::UnorderedElementsAre(neg(0), pos(4)));
+
+    for (auto value : {TruthValue::True, TruthValue::False}) {
+        std::vector model(5, TruthValue::Undefined);
+        model[0] = value;
+        model[4] = TruthValue::True;
+        preprocessor.extend(model);
+        EXPECT_TRUE(extendedModelSatisfies(problem, model));
+        EXPECT_EQ(model[2], value);
+        EXPECT_NE(model[3], value);
+    }
+
+    EXPECT_FALSE(Preprocessor(inout::parse_dimacs("p cnf 2 4\n-1 2 0\n-2 -1 0\n1 -2 0\n2 1 0\n"))
+                     .substituteEquivalences());
+}
+
+TEST(preprocessor, solve_instances) {
+    using namespace sat;
+    const auto satProblem = inout::read_dimacs_file(test::TestData::SatProblem1);
+    const auto model = solvePreprocessed(satProblem);
+    ASSERT_TRUE(model.has_value());
+    EXPECT_TRUE(extendedModelSatisfies(satProblem, *model));
+    EXPECT_FALSE(solvePreprocessed(inout::read_dimacs_file(test::TestData::UnsatProblem1)).has_value());
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
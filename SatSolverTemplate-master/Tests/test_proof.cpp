@@ -0,0 +1,329 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+
+#include "Solver.hpp"
+#include "proof.hpp"
+#include "inout.hpp"
+#include "LratChecker.hpp"
+#include "util/AsyncWriter.hpp"
+#include "testing_utils.hpp"
+
+std::string tempPath(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+std::string readBack(const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(in), {}};
+}
+
+/**
+ * Whether unit propagation on the clauses together with the negation of the clause yields a conflict
+ */
+bool rupImplied(const std::vector<std::vector<int>> &clauses, const std::vector<int> &clause) {
+    std::vector<int> assigned;
+    auto value = [&assigned](int l) {
+        if (std::ranges::find(assigned, l) != assigned.end()) {
+            return 1;
+        }
+
+        return std::ranges::find(assigned, -l) != assigned.end() ? -1 : 0;
+    };
+
+    for (int l : clause) {
+        assigned.push_back(-l);
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto &c : clauses) {
+            int numOpen = 0;
+            int open = 0;
+            bool satisfied = false;
+            for (int l : c) {
+                satisfied |= value(l) == 1;
+                if (value(l) == 0) {
+                    ++numOpen;
+                    open = l;
+                }
+            }
+
+            if (satisfied || numOpen > 1) {
+                continue;
+            }
+
+            if (numOpen == 0) {
+                return true;
+            }
+
+            assigned.push_back(open);
+            changed = true;
+        }
+    }
+
+    return false;
+}
+
+TEST(proof, async_writer) {
+    using namespace sat;
+    const auto path = tempPath("test_proof_async_writer.txt");
+    std::string expected;
+    {
+        // A tiny buffer forces wrap-arounds and writes that are larger than the buffer
+        AsyncWriter writer(path, 7);
+        for (std::size_t i = 0; i < 1000; ++i) {
+            const std::string line = std::to_string(i) + std::string(i % 13, 'x') + "\n";
+            writer.write(line);
+            expected += line;
+        }
+
+        EXPECT_EQ(writer.size(), expected.size());
+        writer.close();
+        writer.write("ignored");
+        EXPECT_NO_THROW(writer.close());
+    }
+
+    EXPECT_EQ(readBack(path), expected);
+    {
+        AsyncWriter writer(path);
+        writer.write("destructor flushes");
+    }
+
+    EXPECT_EQ(readBack(path), "destructor flushes");
+    std::filesystem::remove(path);
+    EXPECT_THROW(AsyncWriter("/nonexistent/dir/proof"), std::runtime_error);
+}
+
+TEST(proof, drat_text) {
+    using namespace sat;
+    const auto path = tempPath("test_proof_drat.txt");
+    Proof proof(path, ProofFormat::Drat);
+    proof.add(3, std::vector{pos(0), neg(1)}, std::vector<std::uint64_t>{1, 2});
+    proof.remove(3, std::vector{pos(0), neg(1)});
+    proof.add(4, {});
+    EXPECT_EQ(proof.numAdded(), 2);
+    EXPECT_EQ(proof.numDeleted(), 1);
+    proof.close();
+    EXPECT_EQ(readBack(path), "1 -2 0\nd 1 -2 0\n0\n");
+    std::filesystem::remove(path);
+}
+
+TEST(proof, drat_binary) {
+    using namespace sat;
+    const auto path = tempPath("test_proof_drat.bin");
+    Proof proof(path, ProofFormat::BinaryDrat);
+    proof.add(1, std::vector{pos(0), neg(99)});
+    proof.remove(2, std::vector{neg(0)});
+    proof.close();
+    // 1 -> 2, -100 -> 201 (0xc9 0x01 in 7 bit groups), -1 -> 3
+    EXPECT_EQ(readBack(path), std::string("a\x02\xc9\x01\0d\x03\0", 8));
+    std::filesystem::remove(path);
+}
+
+TEST(proof, unsat_proof_is_valid) {
+    using namespace sat;
+    const auto path = tempPath("test_proof_unsat.drat");
+    const auto problem = inout::read_dimacs_file(test::TestData::UnsatProblem1);
+    {
+        Proof proof(path, ProofFormat::Drat);
+        Solver solver(static_cast<unsigned>(problem.numVariables));
+        solver.setProof(&proof);
+        ASSERT_TRUE(solver.addClauses(problem.clauses()));
+        ASSERT_FALSE(solver.solve());
+        proof.close();
+    }
+
+    std::vector<std::vector<int>> clauses;
+    for (auto clause : problem.clauses()) {
+        auto &c = clauses.emplace_back();
+        std::ranges::transform(clause, std::back_inserter(c), [](Literal l) { return inout::to_dimacs(l); });
+    }
+
+    std::istringstream lines(readBack(path));
+    std::string line;
+    bool derivedEmpty = false;
+    while (std::getline(lines, line)) {
+        std::istringstream tokens(line);
+        const bool deletion = line.starts_with("d ");
+        if (deletion) {
+            tokens.ignore(2);
+        }
+
+        std::vector<int> clause;
+        for (int l; tokens >> l && l != 0;) {
+            clause.push_back(l);
+        }
+
+        if (deletion) {
+            auto it = std::ranges::find_if(clauses, [&clause](auto c) {
+                return std::ranges::is_permutation(c, clause);
+            });
+            ASSERT_NE(it, clauses.end());
+            clauses.erase(it);
+        } else {
+            ASSERT_TRUE(rupImplied(clauses, clause)) << line;
+            derivedEmpty = clause.empty();
+            clauses.push_back(std::move(clause));
+        }
+    }
+
+    EXPECT_TRUE(derivedEmpty);
+    std::filesystem::remove(path);
+}
+
+TEST(proof, lrat_text) {
+    using namespace sat;
+    const auto path = tempPath("test_proof_lrat.txt");
+    Proof proof(path, ProofFormat::Lrat);
+    EXPECT_TRUE(proof.lrat());
+    proof.add(5, std::vector{pos(0), neg(1)}, std::vector<std::uint64_t>{1, 3});
+    proof.remove(5, std::vector{pos(0), neg(1)});
+    proof.add(6, {}, std::vector<std::uint64_t>{2, 4});
+    proof.close();
+    EXPECT_EQ(readBack(path), "5 1 -2 0 1 3 0\n5 d 5 0\n6 0 2 4 0\n");
+    std::filesystem::remove(path);
+}
+
+TEST(proof, lrat_binary) {
+    using namespace sat;
+    const auto path = tempPath("test_proof_lrat.bin");
+    Proof proof(path, ProofFormat::BinaryLrat);
+    proof.add(70, std::vector{neg(0)}, std::vector<std::uint64_t>{1});
+    proof.remove(70, std::vector{neg(0)});
+    proof.close();
+    // ids and literals use the same encoding: 70 -> 140 (0x8c 0x01), -1 -> 3, 1 -> 2
+    EXPECT_EQ(readBack(path), std::string("a\x8c\x01\x03\0\x02\0d\x8c\x01\0", 11));
+    std::filesystem::remove(path);
+}
+
+TEST(proof, lrat_checker) {
+    using namespace sat;
+    LratChecker checker;
+    // (1 2) (-1 2) (1 -2) (-1 -2)
+    inout::parse_dimacs("p cnf 2 4\n1 2 0\n-1 2 0\n1 -2 0\n-1 -2 0\n", checker);
+    EXPECT_THROW(checker.check("5 2 0 1 3 0\n"), std::runtime_error); // 3 is satisfied by 2
+    EXPECT_THROW(checker.check("5 2 0 1 0\n"), std::runtime_error);   // no conflict
+    EXPECT_THROW(checker.check("5 2 0 9 0\n"), std::runtime_error);   // unknown clause
+    EXPECT_THROW(checker.check("5 2 0 -1 0\n"), std::runtime_error);  // RAT
+    EXPECT_FALSE(checker.refuted());
+    checker.check("5 2 0 1 2 0\n5 d 1 2 0\n");
+    EXPECT_THROW(checker.check("6 0 1 5 0\n"), std::runtime_error);   // 1 has been deleted
+    EXPECT_THROW(checker.check("5 0 5 4 3 0\n"), std::runtime_error); // ids must increase
+    checker.check("6 0 5 4 3 0\n");
+    EXPECT_TRUE(checker.refuted());
+    EXPECT_EQ(checker.numLemmas(), 2);
+}
+
+TEST(proof, lrat_proof_is_valid) {
+    using namespace sat;
+    for (auto format : {ProofFormat::Lrat, ProofFormat::BinaryLrat}) {
+        const auto path = tempPath("test_proof_unsat.lrat");
+        {
+            Proof proof(path, format);
+            SolverLoader loader(&proof);
+            inout::read_dimacs_file(test::TestData::UnsatProblem1, loader);
+            ASSERT_TRUE(loader.ok());
+            ASSERT_FALSE(loader.solver().solve());
+            proof.close();
+        }
+
+        LratChecker checker;
+        inout::read_dimacs_file(test::TestData::UnsatProblem1, checker);
+        EXPECT_NO_THROW(checker.check(readBack(path)));
+        EXPECT_TRUE(checker.refuted());
+        std::filesystem::remove(path);
+    }
+}
+
+TEST(proof, lrat_proof_of_conflicting_units) {
+    using namespace sat;
+    // The conflict is found while loading, the empty clause must not take the id of the last problem clause
+    const std::string problem = "p cnf 2 4\n1 0\n-1 2 0\n-2 0\n1 2 0\n";
+    const auto path = tempPath("test_proof_units.lrat");
+    {
+        Proof proof(path, ProofFormat::Lrat);
+        SolverLoader loader(&proof);
+        inout::parse_dimacs(problem, loader);
+        EXPECT_FALSE(loader.ok());
+        proof.close();
+    }
+
+    LratChecker checker;
+    inout::parse_dimacs(problem, checker);
+    EXPECT_NO_THROW(checker.check(readBack(path)));
+    EXPECT_TRUE(checker.refuted());
+    std::filesystem::remove(path);
+}
+
+TEST(proof, lrat_proof_with_probing) {
+    using namespace sat;
+    // Probing fixes x3 (see solver.probing_common_implications), which makes the last four clauses unsatisfiable
+    const std::string problem = "p cnf 7 9\n5 0\n-1 2 0\n-1 3 0\n-2 -3 4 0\n-5 1 4 0\n"
+                                "-4 6 7 0\n-4 6 -7 0\n-4 -6 7 0\n-4 -6 -7 0\n";
+    for (auto format : {ProofFormat::Lrat, ProofFormat::Drat}) {
+        const auto path = tempPath("test_proof_probing.lrat");
+        {
+            Proof proof(path, format);
+            SolverLoader loader(&proof);
+            inout::parse_dimacs(problem, loader);
+            ASSERT_TRUE(loader.ok());
+            ASSERT_FALSE(loader.solver().solve());
+            EXPECT_EQ(loader.solver().numProbingUnits(), 1);
+            EXPECT_EQ(loader.solver().numHyperBinaries(), 2);
+            proof.close();
+        }
+
+        if (format == ProofFormat::Lrat) {
+            LratChecker checker;
+            inout::parse_dimacs(problem, checker);
+            EXPECT_NO_THROW(checker.check(readBack(path)));
+            EXPECT_TRUE(checker.refuted());
+        } else {
+            const auto parsed = inout::parse_dimacs(problem);
+            std::vector<std::vector<int>> clauses;
+            for (auto clause : parsed.clauses()) {
+                auto &c = clauses.emplace_back();
+                std::ranges::transform(clause, std::back_inserter(c), [](Literal l) { return inout::to_dimacs(l); });
+            }
+
+            std::istringstream lines(readBack(path));
+            for (std::string line; std::getline(lines, line);) {
+                if (line.starts_with("d ")) {
+                    continue;
+                }
+
+                std::istringstream tokens(line);
+                std::vector<int> clause;
+                for (int l; tokens >> l && l != 0;) {
+                    clause.push_back(l);
+                }
+
+                EXPECT_TRUE(rupImplied(clauses, clause)) << line;
+                clauses.push_back(std::move(clause));
+            }
+        }
+
+        std::filesystem::remove(path);
+    }
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
@@ -0,0 +1,92 @@
+/**
+* @author Tim Luchterhand
+* @date 15.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+
+#include "restarts.hpp"
+
+TEST(restarts, luby_sequence) {
+    using namespace sat;
+    std::vector<double> seq;
+    for (unsigned i = 0; i < 15; ++i) {
+        seq.push_back(luby(2, i));
+    }
+
+    EXPECT_THAT(seq, testing::ElementsAre(1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8));
+}
+
+TEST(restarts, moving_average) {
+    using namespace sat;
+    ExponentialMovingAverage ema(0.001);
+    ema.update(4);
+    EXPECT_NEAR(ema.value(), 4, 1e-9) << "bias correction should make the first sample the average";
+    for (int i = 0; i < 100; ++i) {
+        ema.update(8);
+    }
+
+    EXPECT_GT(ema.value(), 7.5);
+    EXPECT_LT(ema.value(), 8);
+}
+
+TEST(restarts, luby_policy) {
+    using namespace sat;
+    Restarts restarts(RestartPolicy::Luby);
+    for (unsigned i = 0; i < Restarts::LubyUnit - 1; ++i) {
+        restarts.onConflict(2, 10);
+        EXPECT_FALSE(restarts.shouldRestart());
+    }
+
+    restarts.onConflict(2, 10);
+    EXPECT_TRUE(restarts.shouldRestart());
+    restarts.restarted();
+    EXPECT_FALSE(restarts.shouldRestart());
+    EXPECT_EQ(restarts.numRestarts(), 1);
+}
+
+TEST(restarts, glucose_policy) {
+    using namespace sat;
+    Restarts restarts(RestartPolicy::Glucose);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        restarts.onConflict(3, 10);
+    }
+
+    EXPECT_FALSE(restarts.shouldRestart()) << "constant LBD should not trigger restarts";
+    for (std::size_t i = 0; i < 100; ++i) {
+        restarts.onConflict(20, 10);
+    }
+
+    EXPECT_TRUE(restarts.shouldRestart()) << "recent LBD spike should trigger a restart";
+}
+
+TEST(restarts, no_restarts) {
+    using namespace sat;
+    Restarts restarts(RestartPolicy::None);
+    for (std::size_t i = 0; i < 10000; ++i) {
+        restarts.onConflict(static_cast<unsigned>(i % 50), 10);
+        ASSERT_FALSE(restarts.shouldRestart());
+    }
+}
+
+TEST(restarts, policy_from_string) {
+    using namespace sat;
+    RestartPolicy policy = RestartPolicy::None;
+    EXPECT_TRUE(from_string("Luby", policy));
+    EXPECT_EQ(policy, RestartPolicy::Luby);
+    EXPECT_FALSE(from_string("luby2", policy));
+    EXPECT_EQ(policy, RestartPolicy::Luby);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
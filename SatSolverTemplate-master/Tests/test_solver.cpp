@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <algorithm>
+#include <fstream>
 
 #include "Solver.hpp"
 #include "inout.hpp"
@@ -104,6 +105,28 @@ TEST(solver, unit_propagation_complex) {
     EXPECT_TRUE(s.unitPropagate()) << "unit propagation failed";
 }
 
+TEST(solver, binary_implication_chain) {
+    using namespace sat;
+    // x0 -> x1 -> x2 -> x3 and (¬x3 or ¬x0 or x4)
+    Solver s(5);
+    for (unsigned x = 0; x < 3; ++x) {
+        ASSERT_TRUE(s.addClause(Clause({neg(x), pos(x + 1)})));
+    }
+
+    ASSERT_TRUE(s.addClause(Clause({neg(3), neg(0), pos(4)})));
+    ASSERT_TRUE(s.assign(pos(0)));
+    ASSERT_TRUE(s.unitPropagate());
+    for (unsigned x = 0; x < 5; ++x) {
+        EXPECT_EQ(s.val(x), TruthValue::True);
+    }
+
+    Solver s2(3);
+    ASSERT_TRUE(s2.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s2.addClause(Clause({neg(0), pos(2)})));
+    ASSERT_TRUE(s2.addClause(Clause({neg(1), neg(2)})));
+    ASSERT_TRUE(s2.assign(pos(0)));
+    EXPECT_FALSE(s2.unitPropagate());
+}
 
 TEST(solver, rebase) {
     using namespace sat;
@@ -122,6 +145,288 @@ TEST(solver, rebase) {
         << "Clause " << Clause({neg(1), pos(2)}) << " was not found";
 }
 
+auto loadProblem(const std::string &cnfFile) {
+    std::ifstream ifs(cnfFile);
+    if (not ifs.is_open()) {
+        std::cerr << "Could not open file " << cnfFile  <<". This should never happen" << std::endl;
+        std::exit(1);
+    }
+
+    return sat::inout::read_from_dimacs(ifs);
+}
+
+template<typename Clauses>
+bool modelSatisfies(const sat::Solver &solver, const Clauses &clauses) {
+    return std::ranges::all_of(clauses, [&solver](const auto &clause) {
+        return std::ranges::any_of(clause, [&solver](auto l) { return solver.satisfied(l); });
+    });
+}
+
+// Pigeon hole problem with holes + 1 pigeons: variable holes * p + h means pigeon p sits in hole h
+sat::Solver pigeonHole(unsigned holes) {
+    using namespace sat;
+    const unsigned pigeons = holes + 1;
+    Solver s(pigeons * holes);
+    for (unsigned p = 0; p < pigeons; ++p) {
+        std::vector<Literal> clause;
+        for (unsigned h = 0; h < holes; ++h) {
+            clause.push_back(pos(holes * p + h));
+        }
+
+        s.addClause(Clause(std::move(clause)));
+    }
+
+    for (unsigned h = 0; h < holes; ++h) {
+        for (unsigned p1 = 0; p1 < pigeons; ++p1) {
+            for (unsigned p2 = p1 + 1; p2 < pigeons; ++p2) {
+                s.addClause(Clause({neg(holes * p1 + h), neg(holes * p2 + h)}));
+            }
+        }
+    }
+
+    return s;
+}
+
+TEST(solver, solve_pigeon_hole_unsat) {
+    auto s = pigeonHole(2);
+    EXPECT_FALSE(s.solve());
+}
+
+TEST(solver, learned_clause_reduction) {
+    auto s = pigeonHole(7);
+    EXPECT_FALSE(s.solve());
+    ASSERT_GT(s.numConflicts(), 2000) << "instance too easy to trigger a reduction";
+    EXPECT_LT(s.numLearntClauses(), s.numConflicts());
+}
+
+TEST(solver, solve_sat_instance) {
+    using namespace sat;
+    auto [clauses, numVariables] = loadProblem(test::TestData::SatProblem1);
+    Solver s(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(clause)));
+    }
+
+    ASSERT_TRUE(s.solve());
+    EXPECT_TRUE(s.allVariablesAssigned());
+    EXPECT_TRUE(modelSatisfies(s, clauses));
+}
+
+TEST(solver, solve_unsat_instance) {
+    using namespace sat;
+    auto [clauses, numVariables] = loadProblem(test::TestData::UnsatProblem1);
+    Solver s(numVariables);
+    for (const auto &clause : clauses) {
+        ASSERT_TRUE(s.addClause(Clause(clause)));
+    }
+
+    EXPECT_FALSE(s.solve());
+}
+
+TEST(solver, learned_clause_minimization) {
+    using namespace sat;
+    // Deciding x0 implies x1, deciding x2 then implies x3 and falsifies the last clause. The first UIP clause
+    // (¬x2 or ¬x0 or ¬x1) contains ¬x1 which is implied by ¬x0
+    Solver s(4);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(2), neg(1), pos(3)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(2), neg(0), neg(3)})));
+    s.setHeuristic(FirstVariable{});
+    ASSERT_TRUE(s.solve());
+    EXPECT_EQ(s.numConflicts(), 1);
+    EXPECT_EQ(s.numMinimizedLiterals(), 1);
+    EXPECT_EQ(s.val(2), TruthValue::False);
+}
+
+TEST(solver, minimization_keeps_unsat_instances_unsat) {
+    auto s = pigeonHole(6);
+    EXPECT_FALSE(s.solve());
+    EXPECT_GT(s.numMinimizedLiterals(), 0);
+}
+
+TEST(solver, solve_under_assumptions) {
+    using namespace sat;
+    // x0 -> x1, x1 -> x2, (¬x2 or ¬x3)
+    Solver s(5);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(2), neg(3)})));
+    const std::vector sat{pos(0), neg(4)};
+    ASSERT_TRUE(s.solve(sat));
+    EXPECT_EQ(s.val(0), TruthValue::True);
+    EXPECT_EQ(s.val(2), TruthValue::True);
+    EXPECT_EQ(s.val(3), TruthValue::False);
+    EXPECT_EQ(s.val(4), TruthValue::False);
+    EXPECT_TRUE(s.failedAssumptions().empty());
+
+    const std::vector unsat{pos(4), pos(3), pos(0)};
+    ASSERT_FALSE(s.solve(unsat));
+    EXPECT_THAT(s.failedAssumptions(), testing::UnorderedElementsAre(pos(0), pos(3)));
+
+    // The formula itself is still satisfiable and clauses can be added between calls
+    ASSERT_TRUE(s.solve());
+    ASSERT_TRUE(s.addClause(Clause({neg(0)})));
+    const std::vector contradicting{pos(0)};
+    ASSERT_FALSE(s.solve(contradicting));
+    EXPECT_THAT(s.failedAssumptions(), testing::ElementsAre(pos(0)));
+    ASSERT_TRUE(s.solve(std::span(unsat).first(2)));
+    EXPECT_EQ(s.val(0), TruthValue::False);
+}
+
+TEST(solver, assumptions_on_unsat_formula) {
+    auto s = pigeonHole(5);
+    const std::vector assumptions{sat::pos(0)};
+    EXPECT_FALSE(s.solve(assumptions));
+    if (!s.failedAssumptions().empty()) {
+        EXPECT_THAT(s.failedAssumptions(), testing::ElementsAre(sat::pos(0)));
+    }
+
+    // Once the formula itself is refuted, the core is empty
+    EXPECT_FALSE(s.solve());
+    const auto conflicts = s.numConflicts();
+    EXPECT_FALSE(s.solve(assumptions));
+    EXPECT_EQ(s.numConflicts(), conflicts);
+    EXPECT_TRUE(s.failedAssumptions().empty());
+}
+
+TEST(solver, add_clauses) {
+    using namespace sat;
+    const std::vector<std::vector<Literal>> clauses{{pos(0), pos(1)}, {neg(0), pos(1), pos(1)}, {neg(1)}, {pos(1)}};
+    Solver s(2);
+    EXPECT_EQ(s.numVariables(), 2);
+    EXPECT_FALSE(s.addClauses(clauses));
+    EXPECT_FALSE(s.solve());
+
+    Solver s2(2);
+    ASSERT_TRUE(s2.addClauses(clauses | std::views::take(2)));
+    ASSERT_TRUE(s2.solve());
+    EXPECT_EQ(s2.val(1), TruthValue::True);
+}
+
+TEST(solver, load_from_dimacs) {
+    using namespace sat;
+    SolverLoader loader;
+    EXPECT_THROW(loader.solver(), std::runtime_error);
+    inout::read_dimacs_file(test::TestData::SatProblem1, loader);
+    ASSERT_TRUE(loader.ok());
+    auto [clauses, numVariables] = loadProblem(test::TestData::SatProblem1);
+    Solver &s = loader.solver();
+    EXPECT_EQ(s.numVariables(), numVariables);
+    ASSERT_TRUE(s.solve());
+    EXPECT_TRUE(modelSatisfies(s, clauses));
+
+    SolverLoader unsat;
+    inout::parse_dimacs("p cnf 2 4\n1 0 -1 0\n1 2 0\n", unsat);
+    EXPECT_FALSE(unsat.ok());
+    EXPECT_FALSE(unsat.solver().solve());
+}
+
+TEST(solver, interrupt) {
+    auto s = pigeonHole(6);
+    std::stop_source stop;
+    s.setStopToken(stop.get_token());
+    stop.request_stop();
+    EXPECT_FALSE(s.solve());
+    EXPECT_TRUE(s.interrupted());
+    EXPECT_EQ(s.numConflicts(), 0);
+
+    // The solver can be resumed with a fresh token
+    s.setStopToken({});
+    EXPECT_FALSE(s.solve());
+    EXPECT_FALSE(s.interrupted());
+}
+
+TEST(solver, conflict_limit) {
+    auto s = pigeonHole(6);
+    s.setConflictLimit(10);
+    EXPECT_FALSE(s.solve());
+    EXPECT_TRUE(s.interrupted());
+    EXPECT_EQ(s.numConflicts(), 10);
+    s.setConflictLimit(std::numeric_limits<std::size_t>::max());
+    EXPECT_FALSE(s.solve());
+    EXPECT_FALSE(s.interrupted());
+}
+
+TEST(solver, failed_literal_probing) {
+    using namespace sat;
+    // x0 is a root of the binary implication graph. x0 implies x1 and x2, which falsify one of the last two clauses
+    Solver s(4);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), neg(2), pos(3)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), neg(2), neg(3)})));
+    // Probing runs before the search, so no conflict of the search is needed
+    s.setConflictLimit(0);
+    EXPECT_FALSE(s.solve());
+    EXPECT_EQ(s.numConflicts(), 0);
+    EXPECT_EQ(s.numProbingUnits(), 1);
+    EXPECT_EQ(s.val(0), TruthValue::False);
+
+    Solver disabled(4);
+    ASSERT_TRUE(disabled.addClauses(std::vector{std::vector{neg(0), pos(1)}, std::vector{neg(0), pos(2)},
+                                                std::vector{neg(1), neg(2), pos(3)},
+                                                std::vector{neg(1), neg(2), neg(3)}}));
+    disabled.useProbing(false);
+    disabled.setConflictLimit(0);
+    EXPECT_FALSE(disabled.solve());
+    EXPECT_EQ(disabled.numProbingUnits(), 0);
+    EXPECT_EQ(disabled.val(0), TruthValue::Undefined);
+}
+
+TEST(solver, probing_common_implications) {
+    using namespace sat;
+    // x0 implies x3 by (¬x1 or ¬x2 or x3), ¬x0 implies x3 by (¬x4 or x0 or x3) since x4 is fixed. Both implications
+    // are added as hyper-binary resolvents (¬x0 or x3) and (x0 or x3), x3 is fixed
+    Solver s(5);
+    ASSERT_TRUE(s.addClause(Clause({pos(4)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), neg(2), pos(3)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(4), pos(0), pos(3)})));
+    s.setConflictLimit(0);
+    EXPECT_FALSE(s.solve());
+    EXPECT_EQ(s.numHyperBinaries(), 2);
+    EXPECT_EQ(s.numLearntClauses(), 2);
+    EXPECT_EQ(s.numProbingUnits(), 1);
+    EXPECT_EQ(s.val(3), TruthValue::True);
+    EXPECT_EQ(s.val(0), TruthValue::Undefined);
+    s.setConflictLimit(std::numeric_limits<std::size_t>::max());
+    EXPECT_TRUE(s.solve());
+}
+
+TEST(solver, lookahead) {
+    using namespace sat;
+    // x0 -> x1 -> x2, x3 -> ¬x0
+    Solver s(4);
+    ASSERT_TRUE(s.addClause(Clause({neg(0), pos(1)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(1), pos(2)})));
+    ASSERT_TRUE(s.addClause(Clause({neg(3), neg(0)})));
+    EXPECT_EQ(s.lookahead({}, pos(0)), 4);
+    EXPECT_EQ(s.lookahead({}, neg(0)), 1);
+    const std::vector assumptions{pos(1)};
+    EXPECT_EQ(s.lookahead(assumptions, pos(0)), 2);
+    EXPECT_EQ(s.lookahead(assumptions, pos(2)), 0);
+    EXPECT_EQ(s.lookahead(assumptions, neg(2)), std::nullopt);
+    const std::vector conflicting{pos(3)};
+    EXPECT_EQ(s.lookahead(conflicting, pos(0)), std::nullopt);
+    for (unsigned varId = 0; varId < 4; ++varId) {
+        EXPECT_EQ(s.val(varId), TruthValue::Undefined);
+    }
+
+    EXPECT_TRUE(s.solve());
+}
+
+TEST(solver, initial_polarity) {
+    using namespace sat;
+    Solver s(3);
+    s.setHeuristic(FirstVariable{});
+    s.setPolarity(Polarity::Negative);
+    ASSERT_TRUE(s.solve());
+    for (unsigned varId = 0; varId < 3; ++varId) {
+        EXPECT_EQ(s.val(varId), TruthValue::False);
+    }
+}
+
 #ifndef __RUN_ALL_TESTS__
 
 int main(int argc, char **argv) {
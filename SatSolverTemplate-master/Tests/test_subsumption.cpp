@@ -0,0 +1,95 @@
+/**
+* @author Tim Luchterhand
+* @date 16.10.26
+* @brief
+*/
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Subsumption.hpp"
+#include "Preprocessor.hpp"
+#include "inout.hpp"
+
+TEST(subsumption, signature) {
+    using namespace sat;
+    EXPECT_EQ(clause_signature(std::vector{pos(0), neg(3)}), 0b1001);
+    EXPECT_EQ(clause_signature(std::vector{neg(0), pos(64)}), 1);
+    EXPECT_EQ(clause_signature(std::vector<Literal>{}), 0);
+}
+
+TEST(subsumption, subsume) {
+    using namespace sat;
+    Subsumption subsumption(4, false);
+    subsumption.add(std::vector{pos(0), pos(1), pos(2)});
+    subsumption.add(std::vector{pos(1), pos(0)});
+    subsumption.add(std::vector{pos(2), pos(1), pos(0)});
+    subsumption.add(std::vector{neg(0), pos(1), pos(3)});
+    subsumption.add(std::vector{pos(0), neg(1), pos(3)});
+    subsumption.run();
+    EXPECT_TRUE(subsumption.subsumed(0));
+    EXPECT_FALSE(subsumption.subsumed(1));
+    EXPECT_TRUE(subsumption.subsumed(2));
+    EXPECT_FALSE(subsumption.subsumed(3));
+    EXPECT_FALSE(subsumption.subsumed(4));
+    EXPECT_EQ(subsumption.numSubsumed(), 2);
+    EXPECT_EQ(subsumption.numStrengthened(), 0);
+    EXPECT_EQ(subsumption.strengthenedBy(3), Subsumption::None);
+}
+
+TEST(subsumption, strengthen) {
+    using namespace sat;
+    Subsumption subsumption(4);
+    // ¬x1 strengthens (x0 or x1) to x0, which strengthens (¬x0 or x1 or x2) to (x1 or x2), which in turn subsumes
+    // (x1 or x2 or x3)
+    subsumption.add(std::vector{neg(0), pos(1), pos(2)});
+    subsumption.add(std::vector{pos(0), pos(1)});
+    subsumption.add(std::vector{pos(1), pos(2), pos(3)});
+    subsumption.add(std::vector{neg(1)});
+    subsumption.run();
+    EXPECT_EQ(subsumption.order().front(), 3);
+    EXPECT_EQ(subsumption.strengthenedBy(1), 3);
+    EXPECT_THAT(subsumption.clause(1), testing::ElementsAre(pos(0)));
+    // Only one strengthening per clause and run
+    EXPECT_EQ(subsumption.strengthenedBy(0), 1);
+    EXPECT_THAT(subsumption.clause(0), testing::UnorderedElementsAre(pos(1), pos(2)));
+    EXPECT_TRUE(subsumption.subsumed(2));
+    EXPECT_EQ(subsumption.numStrengthened(), 2);
+    EXPECT_EQ(subsumption.numSubsumed(), 1);
+}
+
+TEST(subsumption, removable) {
+    using namespace sat;
+    Subsumption subsumption(3);
+    subsumption.add(std::vector{pos(0), pos(1)}, true);
+    subsumption.add(std::vector{pos(1), pos(0)}, false);
+    subsumption.add(std::vector{neg(0)}, true);
+    subsumption.add(std::vector{neg(0), pos(2)}, false);
+    subsumption.run();
+    // Of two equal clauses, the one that is not removable is kept. Clauses that are not removable are never changed
+    EXPECT_TRUE(subsumption.subsumed(0));
+    EXPECT_FALSE(subsumption.subsumed(1));
+    EXPECT_FALSE(subsumption.subsumed(3));
+    EXPECT_EQ(subsumption.strengthenedBy(3), Subsumption::None);
+    EXPECT_EQ(subsumption.clause(3).size(), 2);
+}
+
+TEST(subsumption, preprocessor) {
+    using namespace sat;
+    const auto problem = inout::parse_dimacs("p cnf 4 5\n1 2 3 0\n1 2 0\n-1 2 4 0\n1 2 3 4 0\n-2 3 4 0\n");
+    Preprocessor preprocessor(problem);
+    ASSERT_TRUE(preprocessor.subsume());
+    EXPECT_EQ(preprocessor.numSubsumed(), 2);
+    EXPECT_EQ(preprocessor.numStrengthened(), 2);
+    EXPECT_EQ(preprocessor.numClauses(), 3);
+}
+
+#ifndef __RUN_ALL_TESTS__
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+#endif
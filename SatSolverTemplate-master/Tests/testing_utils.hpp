@@ -27,6 +27,11 @@ namespace test {
         static constexpr auto UnitPropagationSolution2 = __TEST_DATA_DIR__ "res2.cnf";
         static constexpr auto UnitPropagationSolution3 = __TEST_DATA_DIR__ "res3.cnf";
         static constexpr auto UnitPropagationSolution4 = __TEST_DATA_DIR__ "res4.cnf";
+        static constexpr auto SatProblem1 = __TEST_DATA_DIR__ "sat1.cnf";
+        static constexpr auto UnsatProblem1 = __TEST_DATA_DIR__ "unsat1.cnf";
+        static constexpr auto SatProblem1Gzip = __TEST_DATA_DIR__ "sat1.cnf.gz";
+        static constexpr auto SatProblem1Xz = __TEST_DATA_DIR__ "sat1.cnf.xz";
+        static constexpr auto SatProblem1Bzip2 = __TEST_DATA_DIR__ "sat1.cnf.bz2";
     };
 
     template<typename T>
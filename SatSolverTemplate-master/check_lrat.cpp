@@ -0,0 +1,43 @@
+#include <iostream>
+#include "Solver/LratChecker.hpp"
+#include "Solver/BinaryCnf.hpp"
+#include "Solver/util/MappedFile.hpp"
+#include "Solver/util/cli.hpp"
+
+// Verifies an LRAT proof of unsatisfiability (textual or binary) produced by solve --proof-format <Lrat|BinaryLrat>
+int main(int argc, char** argv) {
+    try {
+        // Options: --proof <path of the LRAT proof>
+        std::string proofFile;
+        const std::string file = cli::parse(argc, argv, cli::ValueArg("--proof", proofFile));
+        if (proofFile.empty()) {
+            std::cerr << "c Error: no proof given (--proof <path>)" << std::endl;
+            return 1;
+        }
+
+        sat::LratChecker checker;
+        sat::inout::read_problem_file(file, checker);
+        const sat::MappedFile proof(proofFile);
+        try {
+            checker.check(proof.view());
+        } catch (const std::runtime_error &e) {
+            std::cout << "c " << e.what() << std::endl;
+            std::cout << "s NOT VERIFIED" << std::endl;
+            return 1;
+        }
+
+        std::cout << "c lemmas: " << checker.numLemmas() << std::endl;
+        if (!checker.refuted()) {
+            std::cout << "c the proof does not derive the empty clause" << std::endl;
+            std::cout << "s NOT VERIFIED" << std::endl;
+            return 1;
+        }
+
+        std::cout << "s VERIFIED" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "c Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
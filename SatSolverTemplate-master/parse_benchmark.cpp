@@ -0,0 +1,55 @@
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include "Solver/inout.hpp"
+#include "Solver/util/Profiler.hpp"
+#include "Solver/util/cli.hpp"
+
+// Compares the throughput of the stream based dimacs reader and the memory mapped parser on the given file
+int main(int argc, char** argv) {
+    try {
+        // Options: --repetitions <number of runs per reader>
+        int repetitions = 5;
+        const std::string file = cli::parse(argc, argv, cli::ValueArg("--repetitions", repetitions));
+        const auto fileSize = std::filesystem::file_size(file);
+        sat::Profiler profiler;
+        std::size_t streamLiterals = 0;
+        std::size_t mappedLiterals = 0;
+        for (int i = 0; i < repetitions; ++i) {
+            {
+                sat::ScopeWatch watch(profiler, "stream");
+                std::ifstream inFile(file);
+                auto [clauses, numVars] = sat::inout::read_from_dimacs(inFile);
+                streamLiterals = 0;
+                for (const auto &clause : clauses) {
+                    streamLiterals += clause.size();
+                }
+            }
+
+            {
+                sat::ScopeWatch watch(profiler, "mmap");
+                mappedLiterals = sat::inout::read_dimacs_file(file).literals.size();
+            }
+        }
+
+        if (streamLiterals != mappedLiterals) {
+            std::cerr << "c Error: readers disagree (" << streamLiterals << " vs " << mappedLiterals
+                      << " literals)" << std::endl;
+            return 1;
+        }
+
+        std::cout << "c file: " << file << " (" << fileSize << " bytes, " << mappedLiterals << " literals)"
+                  << std::endl;
+        profiler.printAll<std::chrono::microseconds>(std::cout);
+        for (const auto &reader : {"stream", "mmap"}) {
+            const auto median = profiler.getResult<std::chrono::microseconds>(reader).med;
+            std::cout << "c " << reader << ": " << static_cast<double>(fileSize) / std::max<decltype(median)>(median, 1)
+                      << " MB/s" << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "c Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
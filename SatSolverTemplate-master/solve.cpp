@@ -1,55 +1,198 @@
 #include <iostream>
-#include <fstream>
+#include <optional>
 #include "Solver/Solver.hpp"
-#include "Solver/inout.hpp" 
+#include "Solver/inout.hpp"
+#include "Solver/BinaryCnf.hpp"
+#include "Solver/proof.hpp"
+#include "Solver/Portfolio.hpp"
+#include "Solver/CubeAndConquer.hpp"
+#include "Solver/Preprocessor.hpp"
+#include "Solver/util/cli.hpp"
 
 int main(int argc, char** argv) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <cnf-file>" << std::endl;
-        return 1;
-    }
-
     try {
-        // Read the DIMACS format file
-        std::ifstream inFile(argv[1]);
-        if (!inFile.is_open()) {
-            std::cerr << "c Error: Cannot open file: " << argv[1] << std::endl;
+        // Options: --restart <None|Luby|Glucose>
+        //          --emit-binary <path> (additionally writes the problem in binary CNF format for faster reloading)
+        //          --proof <path> (writes a proof if the instance is unsatisfiable, LRAT proofs can be verified using
+        //                          check_lrat)
+        //          --proof-format <Drat|BinaryDrat|Lrat|BinaryLrat>
+        //          --threads <N> (runs a portfolio of N differently configured solvers in parallel, the first one to
+        //                         finish wins)
+        //          --cube-and-conquer (with --threads: splits the problem into cubes that are solved in parallel
+        //                              instead of running a portfolio)
+        //          --cube-budget <conflicts> (conflicts after which a cube is split again)
+        //          --no-sharing (parallel solvers do not exchange learned clauses)
+        //          --no-preprocess (skips subsumption, equivalent literal substitution and bounded variable
+        //                           elimination before the search, which are always skipped when a proof is
+        //                           written)
+        //          --no-probing (skips failed literal probing and hyper-binary resolution before the search)
+        //          --no-gauss (skips the search for XOR constraints and their Gauss-Jordan elimination, which is
+        //                      always skipped when a proof is written)
+        sat::RestartPolicy restartPolicy = sat::RestartPolicy::Glucose;
+        std::string binaryOutput;
+        std::string proofOutput;
+        sat::ProofFormat proofFormat = sat::ProofFormat::BinaryDrat;
+        unsigned numThreads = 1;
+        bool shareClauses = true;
+        bool cubeAndConquer = false;
+        bool preprocess = true;
+        bool probing = true;
+        bool gauss = true;
+        std::size_t cubeBudget = sat::CubeOptions{}.conflictBudget;
+        const std::string file = cli::parse(argc, argv, cli::ValueArg("--restart", restartPolicy),
+                                            cli::ValueArg("--emit-binary", binaryOutput),
+                                            cli::ValueArg("--proof", proofOutput),
+                                            cli::ValueArg("--proof-format", proofFormat),
+                                            cli::ValueArg("--threads", numThreads),
+                                            cli::Switch("--no-sharing", shareClauses),
+                                            cli::Switch("--cube-and-conquer", cubeAndConquer),
+                                            cli::ValueArg("--cube-budget", cubeBudget),
+                                            cli::Switch("--no-preprocess", preprocess),
+                                            cli::Switch("--no-probing", probing),
+                                            cli::Switch("--no-gauss", gauss));
+        if (numThreads > 1 && !proofOutput.empty()) {
+            std::cerr << "c Error: proofs are not supported with multiple threads" << std::endl;
             return 1;
         }
 
-        auto [clauses, numVars] = sat::inout::read_from_dimacs(inFile);
-        sat::Solver solver(numVars);
+        // Eliminated variables are not justified in the proof
+        preprocess = preprocess && proofOutput.empty();
+        std::optional<sat::inout::DimacsProblem> problem;
+        if (numThreads > 1 || preprocess || !binaryOutput.empty()) {
+            problem.emplace();
+            sat::inout::read_problem_file(file, *problem);
+            if (!binaryOutput.empty()) {
+                sat::inout::write_binary_cnf(binaryOutput, *problem);
+                std::cout << "c wrote binary CNF to " << binaryOutput << std::endl;
+            }
+        }
+
+        std::optional<sat::Preprocessor> preprocessor;
+        if (preprocess) {
+            preprocessor.emplace(*problem);
+            const bool ok = preprocessor->subsume() && preprocessor->substituteEquivalences() &&
+                            preprocessor->eliminateVariables();
+            std::cout << "c preprocessing: " << preprocessor->numSubsumed() << " clauses subsumed, "
+                      << preprocessor->numStrengthened() << " strengthened, " << preprocessor->numSubstituted()
+                      << " variables substituted, " << preprocessor->numEliminated()
+                      << " variables eliminated, " << problem->numClauses() << " -> " << preprocessor->numClauses()
+                      << " clauses" << std::endl;
+            if (!ok) {
+                std::cout << "UNSAT" << std::endl;
+                return 0;
+            }
+
+            *problem = preprocessor->problem();
+        }
+
+        bool satisfiable = false;
+        std::vector<sat::TruthValue> model;
+        if (numThreads > 1) {
+            if (cubeAndConquer) {
+                sat::CubeOptions options{.numThreads = numThreads, .conflictBudget = cubeBudget,
+                                         .shareClauses = shareClauses};
+                auto result = sat::solve_cubes(*problem, options);
+                std::cout << "c cubes: " << result->initialCubes << " initial, " << result->solvedCubes
+                          << " solved, " << result->splits << " split again, " << result->steals << " stolen"
+                          << std::endl;
+                satisfiable = result->satisfiable;
+                model = std::move(result->model);
+            } else {
+                const auto configs = sat::portfolio_configs(numThreads);
+                auto result = sat::solve_portfolio(*problem, configs, shareClauses);
+                const auto &winner = configs[result->winner];
+                std::cout << "c winner: " << result->winner << " (" << winner.branching << ", " << winner.restarts
+                          << ", " << winner.polarity << (winner.targetPhases ? ", target phases" : "") << ")"
+                          << std::endl;
+                std::cout << "c conflicts: " << result->conflicts << std::endl;
+                if (shareClauses) {
+                    sat::ExchangeStats total;
+                    for (const auto &stats : result->exchange) {
+                        total.exported += stats.exported;
+                        total.imported += stats.imported;
+                        total.used += stats.used;
+                    }
+
+                    std::cout << "c shared clauses: " << total.exported << " exported, " << total.imported
+                              << " imported, " << total.used << " used" << std::endl;
+                }
+
+                satisfiable = result->satisfiable;
+                model = std::move(result->model);
+            }
+        } else {
+            std::optional<sat::Proof> proof;
+            if (!proofOutput.empty()) {
+                proof.emplace(proofOutput, proofFormat);
+            }
+
+            // Without preprocessing, the clauses are streamed directly from the file into the solver
+            sat::SolverLoader loader(proof ? &*proof : nullptr);
+            if (!problem) {
+                sat::inout::read_problem_file(file, loader);
+            } else {
+                loader.header(problem->numVariables, problem->numClauses());
+                for (auto clause : problem->clauses()) {
+                    loader.clause(clause);
+                }
+            }
+
+            sat::Solver &solver = loader.solver();
+            if (!loader.ok()) {
+                if (proof) {
+                    proof->close();
+                }
 
-        // Add all clauses
-        for (const auto& clauseLits : clauses) {
-            if (!solver.addClause(sat::Clause(clauseLits))) {
                 std::cout << "UNSAT" << std::endl;
                 return 0;
             }
+
+            solver.setRestartPolicy(restartPolicy);
+            solver.useProbing(probing);
+            solver.useGaussJordan(gauss);
+
+            // Solve the instance
+            satisfiable = solver.solve();
+            std::cout << "c probing: " << solver.numProbingUnits() << " fixed literals, " << solver.numHyperBinaries()
+                      << " hyper-binary resolvents" << std::endl;
+            std::cout << "c gauss-jordan: " << solver.numXors() << " xor constraints, " << solver.numXorPivots()
+                      << " pivots" << std::endl;
+            std::cout << "c conflicts: " << solver.numConflicts() << std::endl;
+            std::cout << "c restarts: " << solver.numRestarts() << std::endl;
+            std::cout << "c learned clauses: " << solver.numLearntClauses() << std::endl;
+            std::cout << "c minimized literals: " << solver.numMinimizedLiterals() << std::endl;
+            std::cout << "c subsumed learned clauses: " << solver.numSubsumedLearnts() << std::endl;
+            if (proof) {
+                proof->close();
+            }
+
+            for (unsigned i = 0; satisfiable && i < solver.numVariables(); ++i) {
+                model.push_back(solver.val(sat::Variable(i)));
+            }
         }
 
-        // Solve the instance
-        if (!solver.solve()) {
+        if (!satisfiable) {
             std::cout << "UNSAT" << std::endl;
             return 0;
         }
 
+        // Assigns the eliminated variables, which do not occur in the simplified problem
+        if (preprocessor) {
+            preprocessor->extend(model);
+        }
+
         // For SAT instances, use to_dimacs to print solution
         std::vector<sat::Literal> solution;
-        for (unsigned i = 0; i < numVars; ++i) {
-            auto val = solver.val(sat::Variable(i));
-            if (val == sat::TruthValue::True) {
-                solution.push_back(sat::pos(sat::Variable(i)));
-            } else {
-                solution.push_back(sat::neg(sat::Variable(i)));
-            }
+        for (unsigned i = 0; i < model.size(); ++i) {
+            const sat::Variable x(i);
+            solution.push_back(model[i] == sat::TruthValue::True ? sat::pos(x) : sat::neg(x));
         }
-        std::cout << sat::inout::to_dimacs(solution);
 
+        std::cout << sat::inout::to_dimacs(solution);
     } catch (const std::exception& e) {
         std::cerr << "c Error: " << e.what() << std::endl;
         return 1;
     }
 
     return 0;
-}
\ No newline at end of file
+}
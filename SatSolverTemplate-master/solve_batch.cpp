@@ -0,0 +1,52 @@
+#include <iostream>
+#include <fstream>
+#include <thread>
+#include "Solver/Batch.hpp"
+#include "Solver/util/cli.hpp"
+
+// Solves many problem files concurrently in a single process, e.g. solve_batch eval --threads 8 --timeout 10
+int main(int argc, char** argv) {
+    try {
+        // Options: --threads <N> (number of instances solved in parallel, default: number of hardware threads)
+        //          --timeout <seconds> (wall clock limit per instance, 0: unlimited)
+        //          --memory <MiB> (memory limit per instance, 0: unlimited)
+        //          --format <Jsonl|Csv>
+        //          --output <path> (default: standard output)
+        sat::BatchOptions options;
+        unsigned numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+        std::size_t memoryMiB = 0;
+        sat::ReportFormat format = sat::ReportFormat::Jsonl;
+        std::string outputFile;
+        // The option parser reports to standard output, which is reserved for the results
+        auto *stdoutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+        const std::string input = cli::parse(argc, argv, cli::ValueArg("--threads", numThreads),
+                                             cli::ValueArg("--timeout", options.timeout),
+                                             cli::ValueArg("--memory", memoryMiB),
+                                             cli::ValueArg("--format", format),
+                                             cli::ValueArg("--output", outputFile));
+        std::cout.rdbuf(stdoutBuffer);
+        options.numThreads = numThreads;
+        options.memoryLimit = memoryMiB << 20;
+        const auto files = sat::collect_instances(input);
+        std::cerr << "c solving " << files.size() << " instances" << std::endl;
+
+        std::ofstream outputStream;
+        if (!outputFile.empty()) {
+            outputStream.open(outputFile);
+            if (!outputStream) {
+                throw std::runtime_error("Cannot open file " + outputFile);
+            }
+        }
+
+        std::ostream &out = outputFile.empty() ? std::cout : outputStream;
+        out << sat::report_header(format) << std::flush;
+        sat::solve_batch(files, options, [&out, format](const sat::BatchResult &result) {
+            out << sat::format_result(result, format) << std::flush;
+        });
+    } catch (const std::exception& e) {
+        std::cerr << "c Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}